@@ -0,0 +1,208 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <telegraph/telegraph>
+#include <vector>
+
+// Number of vertices of the benchmarked graphs.
+static const std::vector<int64_t> ORDERS = {256, 1024, 4096};
+// Edge density of the benchmarked graphs, in parts per thousand.
+static const std::vector<int64_t> DENSITIES = {1, 10, 100};
+
+// Register the orders and densities as arguments of a benchmark.
+inline void order_density(benchmark::internal::Benchmark *b) {
+    b->ArgNames({"order", "density"})->ArgsProduct({ORDERS, DENSITIES});
+}
+
+// Random distinct edges of a graph with a given order and density, in parts per thousand.
+inline std::vector<EID> random_edges(std::size_t n, std::size_t density, unsigned seed = 31) {
+    std::mt19937_64 rng(seed);
+    std::bernoulli_distribution coin(density / 1000.0);
+    std::vector<EID> E;
+    for (VID i = 0; i < n; i++) {
+        for (VID j = 0; j < n; j++) {
+            if (coin(rng)) E.emplace_back(i, j);
+        }
+    }
+    std::shuffle(E.begin(), E.end(), rng);
+    return E;
+}
+
+// Random graph with a given order and density, in parts per thousand.
+template <typename T>
+inline T random_graph(std::size_t n, std::size_t density, unsigned seed = 31) {
+    const std::vector<EID> E = random_edges(n, density, seed);
+    T G(n);
+    G.add_edges(E.begin(), E.end());
+    return G;
+}
+
+// Random vertex pairs of a graph with a given order, either edges or not.
+inline std::vector<EID> random_pairs(std::size_t n, std::size_t k, unsigned seed = 37) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<VID> vertex(0, n - 1);
+    std::vector<EID> E(k);
+    for (EID &e : E) e = EID(vertex(rng), vertex(rng));
+    return E;
+}
+
+template <typename T>
+static void AddVertex(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+    for (auto _ : state) {
+        T G;
+        for (std::size_t i = 0; i < n; i++) benchmark::DoNotOptimize(G.add_vertex());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+static void AddDelEdge(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+    const std::vector<EID> E = random_edges(n, state.range(1));
+    T G(n);
+    for (auto _ : state) {
+        for (const EID &e : E) G.add_edge(e);
+        for (const EID &e : E) G.del_edge(e);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * E.size());
+}
+
+template <typename T>
+static void HasEdge(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+    const T G = random_graph<T>(n, state.range(1));
+    const std::vector<EID> E = random_pairs(n, 1 << 14);
+    for (auto _ : state) {
+        for (const EID &e : E) benchmark::DoNotOptimize(G.has_edge(e));
+    }
+    state.SetItemsProcessed(state.iterations() * E.size());
+}
+
+template <typename T>
+static void Size(benchmark::State &state) {
+    const T G = random_graph<T>(state.range(0), state.range(1));
+    for (auto _ : state) benchmark::DoNotOptimize(G.size());
+}
+
+template <typename T>
+static void Hash(benchmark::State &state) {
+    const T G = random_graph<T>(state.range(0), state.range(1));
+    for (auto _ : state) benchmark::DoNotOptimize(std::hash<IGraph>()(G));
+}
+
+template <typename T>
+static void VertexLabel(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+    T G(n);
+    std::vector<VLB> L(n);
+    for (VID i = 0; i < n; i++) L[i] = "v" + std::to_string(i);
+    for (auto _ : state) {
+        for (VID i = 0; i < n; i++) G.set_label(i, L[i]);
+        for (VID i = 0; i < n; i++) benchmark::DoNotOptimize(G.get_label(i));
+        for (VID i = 0; i < n; i++) G.del_label(i);
+    }
+    state.SetItemsProcessed(state.iterations() * 3 * n);
+}
+
+template <typename T>
+static void VertexAttr(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+    T G(n);
+    for (auto _ : state) {
+        for (VID i = 0; i < n; i++) G.set_attr(i, "w", int(i));
+        for (VID i = 0; i < n; i++) benchmark::DoNotOptimize(G.template get_attr<int>(i, "w"));
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * n);
+}
+
+template <typename T>
+static void EdgeAttr(benchmark::State &state) {
+    T G = random_graph<T>(state.range(0), state.range(1));
+    const std::vector<EID> E(G.E().begin(), G.E().end());
+    for (auto _ : state) {
+        for (const EID &e : E) G.set_attr(e, "weight", 1.0);
+        for (const EID &e : E) benchmark::DoNotOptimize(G.template get_attr<double>(e, "weight"));
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * E.size());
+}
+
+BENCHMARK_TEMPLATE(AddVertex, DenseGraph)->ArgName("order")->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(AddVertex, SparseGraph)->ArgName("order")->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(AddVertex, DynamicGraph)->ArgName("order")->Arg(1 << 10)->Arg(1 << 14);
+
+BENCHMARK_TEMPLATE(AddDelEdge, DenseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(AddDelEdge, SparseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(AddDelEdge, DynamicGraph)->Apply(order_density);
+
+BENCHMARK_TEMPLATE(HasEdge, DenseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(HasEdge, SparseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(HasEdge, DynamicGraph)->Apply(order_density);
+
+BENCHMARK_TEMPLATE(Size, DenseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(Size, SparseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(Size, DynamicGraph)->Apply(order_density);
+
+BENCHMARK_TEMPLATE(Hash, DenseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(Hash, SparseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(Hash, DynamicGraph)->Apply(order_density);
+
+BENCHMARK_TEMPLATE(VertexLabel, DenseGraph)->ArgName("order")->ArgsProduct({ORDERS});
+BENCHMARK_TEMPLATE(VertexLabel, SparseGraph)->ArgName("order")->ArgsProduct({ORDERS});
+BENCHMARK_TEMPLATE(VertexLabel, DynamicGraph)->ArgName("order")->ArgsProduct({ORDERS});
+
+BENCHMARK_TEMPLATE(VertexAttr, DenseGraph)->ArgName("order")->ArgsProduct({ORDERS});
+BENCHMARK_TEMPLATE(VertexAttr, SparseGraph)->ArgName("order")->ArgsProduct({ORDERS});
+BENCHMARK_TEMPLATE(VertexAttr, DynamicGraph)->ArgName("order")->ArgsProduct({ORDERS});
+
+BENCHMARK_TEMPLATE(EdgeAttr, DenseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(EdgeAttr, SparseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(EdgeAttr, DynamicGraph)->Apply(order_density);
+
+template <typename T>
+static void ToAdjacencyList(benchmark::State &state) {
+    const T G = random_graph<T>(state.range(0), state.range(1));
+    for (auto _ : state) benchmark::DoNotOptimize(AdjacencyList(G));
+    state.SetItemsProcessed(state.iterations() * G.size());
+}
+
+template <typename T>
+static void FromAdjacencyList(benchmark::State &state) {
+    // Keep the vertices without children, which are required by the constructor.
+    const T G = random_graph<T>(state.range(0), state.range(1));
+    AdjacencyList A(G);
+    for (const VID &X : G.V()) A[X];
+    for (auto _ : state) benchmark::DoNotOptimize(T(A));
+}
+
+template <typename T>
+static void ToSparseAdjacencyMatrix(benchmark::State &state) {
+    const T G = random_graph<T>(state.range(0), state.range(1));
+    for (auto _ : state) benchmark::DoNotOptimize(SparseAdjacencyMatrix(G));
+    state.SetItemsProcessed(state.iterations() * G.size());
+}
+
+template <typename T>
+static void FromSparseAdjacencyMatrix(benchmark::State &state) {
+    const SparseAdjacencyMatrix A(random_graph<T>(state.range(0), state.range(1)));
+    for (auto _ : state) benchmark::DoNotOptimize(T(A));
+}
+
+BENCHMARK_TEMPLATE(ToAdjacencyList, DenseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(ToAdjacencyList, SparseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(ToAdjacencyList, DynamicGraph)->Apply(order_density);
+
+BENCHMARK_TEMPLATE(FromAdjacencyList, DenseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(FromAdjacencyList, SparseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(FromAdjacencyList, DynamicGraph)->Apply(order_density);
+
+BENCHMARK_TEMPLATE(ToSparseAdjacencyMatrix, DenseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(ToSparseAdjacencyMatrix, SparseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(ToSparseAdjacencyMatrix, DynamicGraph)->Apply(order_density);
+
+BENCHMARK_TEMPLATE(FromSparseAdjacencyMatrix, DenseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(FromSparseAdjacencyMatrix, SparseGraph)->Apply(order_density);
+BENCHMARK_TEMPLATE(FromSparseAdjacencyMatrix, DynamicGraph)->Apply(order_density);
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <vector>
+
+#include "../container/dense_graph.ipp"
+#include "../interface/exceptions.hpp"
+#include "utility.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Breadth-first search tree, indexed by vertex id.
+ */
+struct BFSTree {
+    //! Distance of the unreached vertices.
+    static constexpr std::size_t INF = std::numeric_limits<std::size_t>::max();
+    //! Parent of the unreached vertices.
+    static constexpr VID NONE = std::numeric_limits<VID>::max();
+
+    //! Number of edges from the source to each vertex, INF if unreached.
+    std::vector<std::size_t> distance;
+    //! Parent of each vertex, the source is its own parent, NONE if unreached.
+    std::vector<VID> parent;
+};
+
+/**
+ * @brief Direction-optimizing breadth-first search from a given vertex.
+ *
+ * Each step either expands the frontier top-down, following the children
+ * of its vertices, or bottom-up, looking for a parent in the frontier for
+ * each unvisited vertex, switching direction with the heuristic of Beamer
+ * et al. (2012). Steps run in parallel, each worker thread collecting its
+ * own share of the next frontier. Edges are followed from parent to child.
+ *
+ * If the graph is a DenseGraph, the search runs on its bit-packed adjacency
+ * matrix, see the DenseGraph overload.
+ *
+ * @param G Given graph.
+ * @param X Given source vertex id.
+ * @return BFSTree Distances and parents, indexed by vertex id.
+ * @throws NOT_DEFINED If the source vertex is not defined.
+ */
+inline BFSTree bfs(const IGraph &G, const VID &X);
+
+/**
+ * @brief Direction-optimizing breadth-first search from a given vertex.
+ *
+ * Top-down steps OR the rows of the frontier into the next frontier word by
+ * word, skipping visited words. Bottom-up steps assign each word of unvisited
+ * vertices to a single worker thread, which intersects it with the rows of
+ * the frontier until every vertex in the word has found a parent.
+ *
+ * @param G Given dense graph.
+ * @param X Given source vertex id.
+ * @return BFSTree Distances and parents, indexed by vertex id.
+ * @throws NOT_DEFINED If the source vertex is not defined.
+ */
+inline BFSTree bfs(const DenseGraph &G, const VID &X);
+
+}  // namespace telegraph
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "bfs.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Switch to bottom-up once the frontier edges exceed the unexplored edges over ALPHA.
+static constexpr std::size_t BFS_ALPHA = 15;
+//! Switch back to top-down once the shrinking frontier is below the vertices over BETA.
+static constexpr std::size_t BFS_BETA = 18;
+//! Frontier vertices per parallel chunk.
+static constexpr std::size_t BFS_GRAIN = 256;
+//! Bitmap words per parallel chunk.
+static constexpr std::size_t BFS_WORDS = 16;
+
+/**
+ * @brief State of a breadth-first search shared by the kernels.
+ */
+struct BFSState {
+    //! Current frontier.
+    std::vector<VID> frontier;
+    //! Next frontier, one share per worker thread.
+    std::vector<std::vector<VID>> next;
+    //! Edges leaving the next frontier, one counter per worker thread.
+    std::vector<std::size_t> edges;
+    //! Edges leaving the current frontier.
+    std::size_t mf;
+    //! Edges leaving the unexplored vertices.
+    std::size_t mu;
+    //! Size of the previous frontier.
+    std::size_t prev;
+    //! Whether the current step is bottom-up or not.
+    bool bottom;
+
+    /**
+     * @brief Initialize the state from a given source vertex.
+     *
+     * @param G Given graph.
+     * @param X Given source vertex id.
+     */
+    BFSState(const IGraph &G, const VID &X)
+        : frontier({X}), next(concurrency()), edges(concurrency(), 0),
+          mf(G.out_degree(X)), mu(G.size() - G.out_degree(X)), prev(0), bottom(false) {}
+
+    /**
+     * @brief Choose the direction of the next step.
+     *
+     * @param n Given number of vertices.
+     */
+    inline void direction(std::size_t n) {
+        const std::size_t nf = frontier.size();
+        if (bottom) {
+            bottom = !(nf < prev && nf < n / BFS_BETA);
+        } else {
+            bottom = mf > mu / BFS_ALPHA;
+        }
+    }
+
+    //! Merge the shares of the next frontier into the current one.
+    inline void advance() {
+        prev = frontier.size();
+        frontier.clear();
+        mf = 0;
+        for (std::size_t t = 0; t < next.size(); t++) {
+            frontier.insert(frontier.end(), next[t].begin(), next[t].end());
+            next[t].clear();
+            mf += edges[t];
+            edges[t] = 0;
+        }
+        mu -= std::min(mu, mf);
+    }
+};
+
+}  // namespace detail
+
+inline BFSTree bfs(const IGraph &G, const VID &X) {
+    // Run the bitset kernel on dense graphs.
+    if (const auto *D = dynamic_cast<const DenseGraph *>(&G)) return bfs(*D, X);
+    if (!G.has_vertex(X)) throw NOT_DEFINED(X);
+    // Get the number of vertex slots and bitmap words.
+    const std::size_t n = vertex_bound(G), W = (n + WORD_BITS - 1) / WORD_BITS;
+    // Initialize the tree.
+    BFSTree out;
+    out.distance.assign(n, BFSTree::INF);
+    out.parent.assign(n, BFSTree::NONE);
+    out.distance[X] = 0;
+    out.parent[X] = X;
+    // Visited and frontier bitmaps, the missing vertices are marked as visited.
+    std::vector<std::atomic<Word>> visited(W), front(W);
+    for (auto &w : visited) w.store(~Word(0), std::memory_order_relaxed);
+    for (const VID &Y : G.V()) visited[Y / WORD_BITS].fetch_and(~(Word(1) << (Y % WORD_BITS)), std::memory_order_relaxed);
+    visited[X / WORD_BITS].fetch_or(Word(1) << (X % WORD_BITS), std::memory_order_relaxed);
+    // Visit a vertex from a given parent.
+    detail::BFSState S(G, X);
+    auto visit = [&](const VID &Y, const VID &Z, std::size_t level, std::size_t t) {
+        out.distance[Y] = level;
+        out.parent[Y] = Z;
+        S.next[t].push_back(Y);
+        return G.out_degree(Y);
+    };
+    for (std::size_t level = 1; !S.frontier.empty(); level++) {
+        S.direction(n);
+        if (!S.bottom) {
+            // Expand the frontier, claiming each child through its visited bit.
+            parallel_for(S.frontier.size(), detail::BFS_GRAIN, [&](std::size_t b, std::size_t e, std::size_t t) {
+                std::size_t k = 0;
+                for (std::size_t i = b; i < e; i++) {
+                    const VID &Z = S.frontier[i];
+                    for (const VID &Y : G.Ch(Z)) {
+                        const Word bit = Word(1) << (Y % WORD_BITS);
+                        auto &w = visited[Y / WORD_BITS];
+                        if (w.load(std::memory_order_relaxed) & bit) continue;
+                        if (w.fetch_or(bit, std::memory_order_relaxed) & bit) continue;
+                        k += visit(Y, Z, level, t);
+                    }
+                }
+                S.edges[t] += k;
+            });
+        } else {
+            // Mark the frontier.
+            for (const VID &Z : S.frontier) {
+                front[Z / WORD_BITS].fetch_or(Word(1) << (Z % WORD_BITS), std::memory_order_relaxed);
+            }
+            // Look for a parent in the frontier, each word is owned by a single worker.
+            parallel_for(W, detail::BFS_WORDS, [&](std::size_t b, std::size_t e, std::size_t t) {
+                std::size_t k = 0;
+                for (std::size_t w = b; w < e; w++) {
+                    Word found = 0;
+                    for (Word r = ~visited[w].load(std::memory_order_relaxed); r; r &= r - 1) {
+                        const VID Y = w * WORD_BITS + __builtin_ctzll(r);
+                        for (const VID &Z : G.Pa(Y)) {
+                            if (!((front[Z / WORD_BITS].load(std::memory_order_relaxed) >> (Z % WORD_BITS)) & 1)) continue;
+                            k += visit(Y, Z, level, t);
+                            found |= Word(1) << (Y % WORD_BITS);
+                            break;
+                        }
+                    }
+                    if (found) visited[w].fetch_or(found, std::memory_order_relaxed);
+                }
+                S.edges[t] += k;
+            });
+            // Clear the frontier marks.
+            for (const VID &Z : S.frontier) front[Z / WORD_BITS].store(0, std::memory_order_relaxed);
+        }
+        S.advance();
+    }
+    return out;
+}
+
+inline BFSTree bfs(const DenseGraph &G, const VID &X) {
+    if (!G.has_vertex(X)) throw NOT_DEFINED(X);
+    // Get the adjacency matrix, the number of vertex slots and bitmap words.
+    const BitMatrix &A = G.adjacency();
+    const std::size_t n = A.rows(), W = (n + WORD_BITS - 1) / WORD_BITS;
+    // Initialize the tree.
+    BFSTree out;
+    out.distance.assign(n, BFSTree::INF);
+    out.parent.assign(n, BFSTree::NONE);
+    out.distance[X] = 0;
+    out.parent[X] = X;
+    // Visited bitmap, the padding bits are marked as visited.
+    std::vector<Word> visited(W, 0);
+    if (n % WORD_BITS) visited[W - 1] = ~Word(0) << (n % WORD_BITS);
+    visited[X / WORD_BITS] |= Word(1) << (X % WORD_BITS);
+    // Bitmap of the vertices claimed during a top-down step.
+    std::vector<std::atomic<Word>> claimed(W);
+    // Visit the vertices of a word from a given parent.
+    detail::BFSState S(G, X);
+    auto visit = [&](std::size_t w, Word h, const VID &Z, std::size_t level, std::size_t t) {
+        std::size_t k = 0;
+        for (; h; h &= h - 1) {
+            const VID Y = w * WORD_BITS + __builtin_ctzll(h);
+            out.distance[Y] = level;
+            out.parent[Y] = Z;
+            S.next[t].push_back(Y);
+            k += G.out_degree(Y);
+        }
+        return k;
+    };
+    for (std::size_t level = 1; !S.frontier.empty(); level++) {
+        S.direction(n);
+        if (!S.bottom) {
+            // OR the frontier rows into the claimed bitmap, masking the visited words.
+            parallel_for(S.frontier.size(), detail::BFS_GRAIN, [&](std::size_t b, std::size_t e, std::size_t t) {
+                std::size_t k = 0;
+                for (std::size_t i = b; i < e; i++) {
+                    const VID &Z = S.frontier[i];
+                    const Word *row = A.row(Z);
+                    for (std::size_t w = 0; w < W; w++) {
+                        Word h = row[w] & ~visited[w];
+                        if (!h) continue;
+                        h &= ~claimed[w].fetch_or(h, std::memory_order_relaxed);
+                        k += visit(w, h, Z, level, t);
+                    }
+                }
+                S.edges[t] += k;
+            });
+            S.advance();
+            // Fold the claimed vertices into the visited bitmap.
+            for (const VID &Y : S.frontier) {
+                visited[Y / WORD_BITS] |= Word(1) << (Y % WORD_BITS);
+                claimed[Y / WORD_BITS].store(0, std::memory_order_relaxed);
+            }
+        } else {
+            // Intersect each word of unvisited vertices with the frontier rows,
+            // stopping as soon as every vertex in the word has found a parent.
+            parallel_for(W, detail::BFS_WORDS, [&](std::size_t b, std::size_t e, std::size_t t) {
+                std::size_t k = 0;
+                for (std::size_t w = b; w < e; w++) {
+                    Word r = ~visited[w];
+                    for (std::size_t i = 0; r && i < S.frontier.size(); i++) {
+                        const VID &Z = S.frontier[i];
+                        const Word h = A.row(Z)[w] & r;
+                        if (!h) continue;
+                        k += visit(w, h, Z, level, t);
+                        r &= ~h;
+                    }
+                    visited[w] = ~r;
+                }
+                S.edges[t] += k;
+            });
+            S.advance();
+        }
+    }
+    return out;
+}
+
+}  // namespace telegraph
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include "csr.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Centrality scores computed by power iteration, indexed by vertex id.
+ */
+struct Centrality {
+    //! Score of each vertex, zero if the vertex id is missing.
+    std::vector<double> score;
+    //! Number of iterations run.
+    std::size_t iterations;
+    //! L1 norm of the change of the scores in the last iteration.
+    double residual;
+};
+
+/**
+ * @brief PageRank of the vertices of the graph.
+ *
+ * The transition matrix is built once as a transposed CSR snapshot, each
+ * edge weighing the inverse of the out-degree of its source, then each
+ * iteration pulls the scores of the parents of every vertex in parallel.
+ * The score of vertices without children is spread uniformly.
+ *
+ * Starting from the scores of a previous run, e.g. before a few edges were
+ * added, converges in fewer iterations than starting from uniform scores.
+ *
+ * @param G Given graph.
+ * @param damping Given probability of following an edge rather than jumping to a random vertex.
+ * @param tolerance Given L1 norm of the change of the scores below which the iteration stops.
+ * @param iterations Given maximum number of iterations.
+ * @param start Given initial scores, vertices beyond its size start uniform, empty for uniform scores.
+ * @return Centrality Scores summing to one.
+ */
+inline Centrality pagerank(const IGraph &G, double damping = 0.85, double tolerance = 1e-9,
+                           std::size_t iterations = 100, const std::vector<double> &start = {});
+
+/**
+ * @brief Eigenvector centrality of the vertices of the graph.
+ *
+ * Scores are the principal eigenvector of the transposed adjacency matrix,
+ * i.e. each vertex scores the sum of the scores of its parents. Iterations
+ * are shifted by the identity, which does not change the eigenvectors but
+ * avoids oscillations on bipartite graphs.
+ *
+ * @param G Given graph.
+ * @param tolerance Given L1 norm of the change of the scores below which the iteration stops.
+ * @param iterations Given maximum number of iterations.
+ * @param start Given initial scores, vertices beyond its size start uniform, empty for uniform scores.
+ * @return Centrality Scores with unit Euclidean norm.
+ */
+inline Centrality eigenvector_centrality(const IGraph &G, double tolerance = 1e-9, std::size_t iterations = 100,
+                                         const std::vector<double> &start = {});
+
+/**
+ * @brief Katz centrality of the vertices of the graph.
+ *
+ * Each vertex scores *beta* plus *alpha* times the sum of the scores of its
+ * parents. The iteration converges only if *alpha* is lower than the inverse
+ * of the largest eigenvalue of the adjacency matrix.
+ *
+ * @param G Given graph.
+ * @param alpha Given attenuation factor.
+ * @param beta Given base score.
+ * @param tolerance Given L1 norm of the change of the scores below which the iteration stops.
+ * @param iterations Given maximum number of iterations.
+ * @param start Given initial scores, vertices beyond its size start from *beta*, empty for *beta*.
+ * @return Centrality Scores.
+ */
+inline Centrality katz_centrality(const IGraph &G, double alpha = 0.1, double beta = 1, double tolerance = 1e-9,
+                                  std::size_t iterations = 1000, const std::vector<double> &start = {});
+
+}  // namespace telegraph
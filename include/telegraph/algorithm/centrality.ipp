@@ -0,0 +1,169 @@
+#pragma once
+
+#include "centrality.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Vertices per parallel chunk of an iteration.
+static constexpr std::size_t RANK_GRAIN = 1024;
+
+/**
+ * @brief Sum a function over the chunks of an index range in parallel.
+ *
+ * Partial sums are kept per chunk and added in order, hence the result
+ * does not depend on the number of worker threads.
+ *
+ * @tparam F Function typename, callable as f(begin, end) returning a double.
+ * @param n Given number of indices.
+ * @param f Given function.
+ * @return double Sum over the chunks.
+ */
+template <typename F>
+inline double parallel_sum(std::size_t n, const F &f) {
+    std::vector<double> partial((n + RANK_GRAIN - 1) / RANK_GRAIN, 0);
+    parallel_for(n, RANK_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) { partial[b / RANK_GRAIN] = f(b, e); });
+    double out = 0;
+    for (const double &p : partial) out += p;
+    return out;
+}
+
+/**
+ * @brief Initial scores of the vertices of a graph.
+ *
+ * @param G Given graph.
+ * @param n Given upper bound of the vertex ids.
+ * @param start Given initial scores.
+ * @param fill Given score of the vertices beyond the initial ones.
+ * @return std::vector<double> Initial scores, zero if the vertex id is missing.
+ */
+inline std::vector<double> initial_scores(const IGraph &G, std::size_t n, const std::vector<double> &start,
+                                          double fill) {
+    std::vector<double> out(n, 0);
+    for (const VID &X : G.V()) out[X] = X < start.size() ? start[X] : fill;
+    return out;
+}
+
+/**
+ * @brief Power iteration until the change of the scores is below a tolerance.
+ *
+ * @tparam F Function typename, callable as f(x, y) writing the next scores *y* of the scores *x*.
+ * @param x Given initial scores.
+ * @param tolerance Given L1 norm of the change of the scores below which the iteration stops.
+ * @param iterations Given maximum number of iterations.
+ * @param step Given function.
+ * @return Centrality Final scores.
+ */
+template <typename F>
+inline Centrality power_iteration(std::vector<double> x, double tolerance, std::size_t iterations, const F &step) {
+    Centrality out;
+    out.iterations = 0;
+    out.residual = 0;
+    std::vector<double> y(x.size());
+    while (out.iterations < iterations) {
+        step(x, y);
+        out.iterations++;
+        out.residual = parallel_sum(x.size(), [&](std::size_t b, std::size_t e) {
+            double d = 0;
+            for (std::size_t i = b; i < e; i++) d += std::abs(y[i] - x[i]);
+            return d;
+        });
+        x.swap(y);
+        if (out.residual < tolerance) break;
+    }
+    out.score = std::move(x);
+    return out;
+}
+
+}  // namespace detail
+
+inline Centrality pagerank(const IGraph &G, double damping, double tolerance, std::size_t iterations,
+                           const std::vector<double> &start) {
+    const std::size_t N = G.order();
+    if (N == 0) return {{}, 0, 0};
+    // Weigh each edge by the inverse out-degree of its source, then pull along the transposed edges.
+    CSR C(G);
+    C.weights.resize(C.nonzeros());
+    std::vector<VID> dangling;
+    for (const VID &X : G.V()) {
+        const std::size_t k = C.offsets[X + 1] - C.offsets[X];
+        if (k == 0) dangling.push_back(X);
+        std::fill(C.weights.begin() + C.offsets[X], C.weights.begin() + C.offsets[X + 1], 1.0 / k);
+    }
+    const CSR T = C.transpose();
+    const std::size_t n = T.rows();
+    // Mark the vertices that receive the random jumps.
+    std::vector<bool> present(n, false);
+    for (const VID &X : G.V()) present[X] = true;
+    // Normalize the initial scores to a probability distribution.
+    std::vector<double> x = detail::initial_scores(G, n, start, 1.0 / N);
+    double sum = 0;
+    for (const double &v : x) sum += v;
+    if (sum > 0) {
+        for (double &v : x) v /= sum;
+    } else {
+        for (const VID &X : G.V()) x[X] = 1.0 / N;
+    }
+    return detail::power_iteration(std::move(x), tolerance, iterations, [&](const auto &x, auto &y) {
+        // Spread the score of the dangling vertices along with the random jumps.
+        double d = 0;
+        for (const VID &X : dangling) d += x[X];
+        const double jump = (1 - damping + damping * d) / N;
+        parallel_for(n, detail::RANK_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+            for (VID Y = b; Y < e; Y++) {
+                if (!present[Y]) {
+                    y[Y] = 0;
+                    continue;
+                }
+                double s = 0;
+                for (std::size_t j = T.offsets[Y]; j < T.offsets[Y + 1]; j++) s += T.weights[j] * x[T.targets[j]];
+                y[Y] = jump + damping * s;
+            }
+        });
+    });
+}
+
+inline Centrality eigenvector_centrality(const IGraph &G, double tolerance, std::size_t iterations,
+                                         const std::vector<double> &start) {
+    const CSR T = CSR(G).transpose();
+    const std::size_t n = T.rows();
+    std::vector<double> x = detail::initial_scores(G, n, start, 1.0 / std::max<std::size_t>(1, G.order()));
+    return detail::power_iteration(std::move(x), tolerance, iterations, [&](const auto &x, auto &y) {
+        // Multiply by the shifted matrix, then normalize.
+        const double norm = std::sqrt(detail::parallel_sum(n, [&](std::size_t b, std::size_t e) {
+            double out = 0;
+            for (VID Y = b; Y < e; Y++) {
+                double s = x[Y];
+                for (std::size_t j = T.offsets[Y]; j < T.offsets[Y + 1]; j++) s += x[T.targets[j]];
+                y[Y] = s;
+                out += s * s;
+            }
+            return out;
+        }));
+        if (norm == 0) return;
+        parallel_for(n, detail::RANK_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+            for (VID Y = b; Y < e; Y++) y[Y] /= norm;
+        });
+    });
+}
+
+inline Centrality katz_centrality(const IGraph &G, double alpha, double beta, double tolerance,
+                                  std::size_t iterations, const std::vector<double> &start) {
+    const CSR T = CSR(G).transpose();
+    const std::size_t n = T.rows();
+    std::vector<bool> present(n, false);
+    for (const VID &X : G.V()) present[X] = true;
+    std::vector<double> x = detail::initial_scores(G, n, start, beta);
+    return detail::power_iteration(std::move(x), tolerance, iterations, [&](const auto &x, auto &y) {
+        parallel_for(n, detail::RANK_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+            for (VID Y = b; Y < e; Y++) {
+                double s = 0;
+                for (std::size_t j = T.offsets[Y]; j < T.offsets[Y + 1]; j++) s += x[T.targets[j]];
+                y[Y] = present[Y] ? beta + alpha * s : 0;
+            }
+        });
+    });
+}
+
+}  // namespace telegraph
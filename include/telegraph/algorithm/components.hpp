@@ -0,0 +1,186 @@
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "../interface/exceptions.hpp"
+#include "csr.ipp"
+#include "dfs.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Partition of the vertices into components, indexed by vertex id.
+ */
+struct Components {
+    //! Component of the missing vertex ids.
+    static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+    //! Component of each vertex, between 0 and count-1, NONE if the vertex id is missing.
+    std::vector<std::size_t> component;
+    //! Number of components.
+    std::size_t count;
+};
+
+/**
+ * @brief Strongly connected components of the graph.
+ *
+ * Tarjan's algorithm on top of the iterative depth-first search, hence it
+ * runs in linear time without recursion. Components are numbered in reverse
+ * topological order of the condensation, i.e. edges between different
+ * components go from a higher to a lower component.
+ *
+ * @param G Given graph.
+ * @return Components Strongly connected components.
+ */
+inline Components strongly_connected_components(const IGraph &G);
+
+/**
+ * @brief Weakly connected components of the graph.
+ *
+ * Edge directions are ignored. Components are numbered in increasing order
+ * of their lowest vertex id, see ConnectedComponents.
+ *
+ * @param G Given graph.
+ * @return Components Weakly connected components.
+ */
+inline Components weakly_connected_components(const IGraph &G);
+
+/**
+ * @brief Incremental weakly connected components, over a lock-free union-find.
+ *
+ * Each vertex points to a parent in the same component, the root being
+ * the lowest vertex id, since roots are always linked under lower roots.
+ * Roots are linked with a compare-and-swap and paths are halved while they
+ * are followed, hence edges can be merged by many threads without locks.
+ *
+ * Components are built from a graph with the Afforest scheme: a couple of
+ * edges per vertex are merged first, then the remaining edges are merged
+ * only for the vertices outside the largest component found so far, which
+ * on real-world graphs skips most of the edges. Later edges and vertices
+ * are merged as they are added to the graph, without recomputation. Edge
+ * and vertex deletions are not tracked.
+ */
+class ConnectedComponents {
+   public:
+    //! Parent of the missing vertex ids.
+    static constexpr VID NONE = std::numeric_limits<VID>::max();
+
+   protected:
+    //! Parent of each vertex id, NONE if the vertex is missing, mutable for path halving.
+    mutable std::vector<std::atomic<VID>> parent;
+    //! Upper bound of the vertex ids.
+    std::size_t bound;
+    //! Number of components.
+    std::size_t k;
+
+    /**
+     * @brief Root of the component of a vertex, halving its path.
+     *
+     * @param X Given vertex id.
+     * @return VID Root vertex id.
+     */
+    inline VID root(VID X) const;
+
+    /**
+     * @brief Merge the components of two vertices.
+     *
+     * @param X Given first vertex id.
+     * @param Y Given second vertex id.
+     * @return true If the components were different,
+     * @return false Otherwise.
+     */
+    inline bool unite(VID X, VID Y);
+
+    /**
+     * @brief Merge the components of a contiguous sequence of edges, in parallel.
+     *
+     * @param first First edge pointer.
+     * @param last Last edge pointer.
+     */
+    inline void bulk_add_edges(const EID *first, const EID *last);
+
+   public:
+    //! Default constructor for an empty ConnectedComponents object.
+    ConnectedComponents();
+
+    /**
+     * @brief Construct a new ConnectedComponents object from a given graph.
+     *
+     * @param G Given graph.
+     */
+    explicit ConnectedComponents(const IGraph &G);
+
+    //! Number of components.
+    inline std::size_t count() const;
+
+    /**
+     * @brief Check if a vertex is tracked.
+     *
+     * @param X Given vertex id.
+     * @return true If the vertex is tracked,
+     * @return false Otherwise.
+     */
+    inline bool has_vertex(const VID &X) const;
+
+    /**
+     * @brief Track a new vertex, as a component of its own.
+     *
+     * @param X Given vertex id.
+     * @throws ALREADY_DEFINED If the vertex is already tracked.
+     */
+    inline void add_vertex(const VID &X);
+
+    /**
+     * @brief Merge the components of the endpoints of an edge.
+     *
+     * @param X Given edge id.
+     * @throws NOT_DEFINED If an endpoint is not tracked.
+     */
+    inline void add_edge(const EID &X);
+
+    /**
+     * @brief Merge the components of a sequence of edges, in parallel.
+     *
+     * Every vertex is checked before any component is merged.
+     *
+     * @tparam I Iterator typename.
+     * @tparam require_iter_value_type(I, EID) Require the iterator value type to be EID.
+     * @param begin First iterator.
+     * @param end Last iterator.
+     * @throws NOT_DEFINED If an endpoint is not tracked.
+     */
+    template <typename I, require_iter_value_type(I, EID) = 0>
+    inline void add_edges(const I &begin, const I &end);
+
+    /**
+     * @brief Representative of the component of a vertex, i.e. its lowest vertex id.
+     *
+     * @param X Given vertex id.
+     * @return VID Representative vertex id.
+     * @throws NOT_DEFINED If the vertex is not tracked.
+     */
+    inline VID find(const VID &X) const;
+
+    /**
+     * @brief Check if two vertices are in the same component.
+     *
+     * @param X Given first vertex id.
+     * @param Y Given second vertex id.
+     * @return true If the vertices are in the same component,
+     * @return false Otherwise.
+     * @throws NOT_DEFINED If a vertex is not tracked.
+     */
+    inline bool connected(const VID &X, const VID &Y) const;
+
+    /**
+     * @brief Dense component ids, in increasing order of the lowest vertex id.
+     *
+     * @return Components Component of each vertex id.
+     */
+    inline Components components() const;
+};
+
+}  // namespace telegraph
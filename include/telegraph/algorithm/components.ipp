@@ -0,0 +1,228 @@
+#pragma once
+
+#include "components.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Vertices or edges per parallel chunk of a union-find pass.
+static constexpr std::size_t UNION_GRAIN = 1024;
+//! Edges per vertex merged before sampling the largest component.
+static constexpr std::size_t AFFOREST_ROUNDS = 2;
+//! Vertices sampled to find the largest component.
+static constexpr std::size_t AFFOREST_SAMPLES = 1024;
+
+/**
+ * @brief Root of the tree of a vertex in a lock-free union-find forest, halving its path.
+ *
+ * Parents only decrease, hence relaxed accesses are enough.
+ *
+ * @param parent Given parent of each vertex id.
+ * @param X Given vertex id.
+ * @return VID Root vertex id.
+ */
+inline VID find_root(std::vector<std::atomic<VID>> &parent, VID X) {
+    while (true) {
+        VID P = parent[X].load(std::memory_order_relaxed);
+        if (P == X) return X;
+        const VID Q = parent[P].load(std::memory_order_relaxed);
+        if (Q == P) return P;
+        // Halve the path, a failure means another thread already lowered it.
+        parent[X].compare_exchange_weak(P, Q, std::memory_order_relaxed);
+        X = Q;
+    }
+}
+
+/**
+ * @brief Merge the trees of two vertices in a lock-free union-find forest.
+ *
+ * @param parent Given parent of each vertex id.
+ * @param X Given first vertex id.
+ * @param Y Given second vertex id.
+ * @return true If the trees were different,
+ * @return false Otherwise.
+ */
+inline bool link_roots(std::vector<std::atomic<VID>> &parent, VID X, VID Y) {
+    while (true) {
+        X = find_root(parent, X);
+        Y = find_root(parent, Y);
+        if (X == Y) return false;
+        if (X < Y) std::swap(X, Y);
+        // Link the higher root under the lower one, retry if it is no longer a root.
+        VID R = X;
+        if (parent[X].compare_exchange_strong(R, Y, std::memory_order_relaxed)) return true;
+    }
+}
+
+}  // namespace detail
+
+inline Components strongly_connected_components(const IGraph &G) {
+    const std::size_t n = vertex_bound(G);
+    Components out;
+    out.component.assign(n, Components::NONE);
+    out.count = 0;
+    // Discovery index and lowest reachable index of each vertex.
+    std::vector<std::size_t> index(n), low(n);
+    // Vertices of the components not assigned yet.
+    std::vector<VID> open;
+    std::vector<detail::Color> color(n, detail::WHITE);
+    std::vector<detail::DFSFrame> stack;
+    std::size_t t = 0;
+    for (const VID &X : G.V()) {
+        if (color[X] != detail::WHITE) continue;
+        detail::dfs_visit(
+            G, X, color, stack,
+            [&](const VID &Y, const VID &) {
+                index[Y] = low[Y] = t++;
+                open.push_back(Y);
+            },
+            [&](const VID &Y) {
+                // Propagate the lowest index to the parent frame, if any.
+                if (stack.size() > 1) {
+                    const VID &Z = stack[stack.size() - 2].X;
+                    low[Z] = std::min(low[Z], low[Y]);
+                }
+                if (low[Y] != index[Y]) return;
+                // Y is the root of a component, pop it with its descendants.
+                VID Z;
+                do {
+                    Z = open.back();
+                    open.pop_back();
+                    out.component[Z] = out.count;
+                } while (Z != Y);
+                out.count++;
+            },
+            [&](const VID &Z, const VID &Y) {
+                // Only the vertices of open components lower the index.
+                if (out.component[Y] == Components::NONE) low[Z] = std::min(low[Z], index[Y]);
+                return true;
+            });
+    }
+    return out;
+}
+
+inline Components weakly_connected_components(const IGraph &G) { return ConnectedComponents(G).components(); }
+
+ConnectedComponents::ConnectedComponents() : bound(0), k(0) {}
+
+ConnectedComponents::ConnectedComponents(const IGraph &G)
+    : parent(vertex_bound(G)), bound(parent.size()), k(G.order()) {
+    for (auto &p : parent) p.store(NONE, std::memory_order_relaxed);
+    for (const VID &X : G.V()) parent[X].store(X, std::memory_order_relaxed);
+    // Snapshot both directions, edges are merged from either endpoint.
+    const CSR C(G), T = C.transpose();
+    std::atomic<std::size_t> merged(0);
+    auto merge = [&](const VID &X, std::size_t first, std::size_t last, const std::vector<VID> &targets) {
+        std::size_t count = 0;
+        for (std::size_t j = first; j < last; j++) count += unite(X, targets[j]);
+        return count;
+    };
+    // Merge the first edges of each vertex.
+    parallel_for(bound, detail::UNION_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        std::size_t count = 0;
+        for (VID X = b; X < e; X++) {
+            count += merge(X, C.offsets[X], std::min(C.offsets[X] + detail::AFFOREST_ROUNDS, C.offsets[X + 1]),
+                           C.targets);
+        }
+        merged.fetch_add(count, std::memory_order_relaxed);
+    });
+    // Sample the largest component, evenly over the vertex ids.
+    VID L = NONE;
+    std::unordered_map<VID, std::size_t> frequency;
+    const std::size_t stride = std::max<std::size_t>(1, bound / detail::AFFOREST_SAMPLES);
+    for (VID X = 0; X < bound; X += stride) {
+        if (parent[X].load(std::memory_order_relaxed) == NONE) continue;
+        const VID R = root(X);
+        if (++frequency[R] > (L == NONE ? 0 : frequency[L])) L = R;
+    }
+    // Merge the remaining edges of the vertices outside of it, including their incoming ones.
+    parallel_for(bound, detail::UNION_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        std::size_t count = 0;
+        for (VID X = b; X < e; X++) {
+            if (parent[X].load(std::memory_order_relaxed) == NONE || root(X) == L) continue;
+            count += merge(X, std::min(C.offsets[X] + detail::AFFOREST_ROUNDS, C.offsets[X + 1]), C.offsets[X + 1],
+                           C.targets);
+            count += merge(X, T.offsets[X], T.offsets[X + 1], T.targets);
+        }
+        merged.fetch_add(count, std::memory_order_relaxed);
+    });
+    k -= merged.load();
+}
+
+inline VID ConnectedComponents::root(VID X) const { return detail::find_root(parent, X); }
+
+inline bool ConnectedComponents::unite(VID X, VID Y) { return detail::link_roots(parent, X, Y); }
+
+inline void ConnectedComponents::bulk_add_edges(const EID *first, const EID *last) {
+    for (const EID *e = first; e != last; e++) {
+        if (!has_vertex(e->first)) throw NOT_DEFINED(e->first);
+        if (!has_vertex(e->second)) throw NOT_DEFINED(e->second);
+    }
+    std::atomic<std::size_t> merged(0);
+    parallel_for(last - first, detail::UNION_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        std::size_t count = 0;
+        for (std::size_t i = b; i < e; i++) count += unite(first[i].first, first[i].second);
+        merged.fetch_add(count, std::memory_order_relaxed);
+    });
+    k -= merged.load();
+}
+
+inline std::size_t ConnectedComponents::count() const { return k; }
+
+inline bool ConnectedComponents::has_vertex(const VID &X) const {
+    return X < bound && parent[X].load(std::memory_order_relaxed) != NONE;
+}
+
+inline void ConnectedComponents::add_vertex(const VID &X) {
+    if (has_vertex(X)) throw ALREADY_DEFINED(X);
+    // Grow the capacity geometrically, atomics are copied by value.
+    if (X >= parent.size()) {
+        std::vector<std::atomic<VID>> other(std::max<std::size_t>(X + 1, 2 * parent.size()));
+        for (std::size_t i = 0; i < other.size(); i++) {
+            other[i].store(i < bound ? parent[i].load(std::memory_order_relaxed) : NONE, std::memory_order_relaxed);
+        }
+        parent.swap(other);
+    }
+    // Clear the slots skipped by a sparse vertex id.
+    for (; bound <= X; bound++) parent[bound].store(NONE, std::memory_order_relaxed);
+    parent[X].store(X, std::memory_order_relaxed);
+    k++;
+}
+
+inline void ConnectedComponents::add_edge(const EID &X) { bulk_add_edges(&X, &X + 1); }
+
+template <typename I, require_iter_value_type(I, EID)>
+inline void ConnectedComponents::add_edges(const I &begin, const I &end) {
+    if constexpr (is_contiguous_iterator<I>::value) {
+        // Pass contiguous sequences through without copying.
+        const EID *first = begin == end ? nullptr : &*begin;
+        bulk_add_edges(first, first + std::distance(begin, end));
+    } else {
+        // Collect the sequence into contiguous memory.
+        std::vector<EID> E(begin, end);
+        bulk_add_edges(E.data(), E.data() + E.size());
+    }
+}
+
+inline VID ConnectedComponents::find(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    return root(X);
+}
+
+inline bool ConnectedComponents::connected(const VID &X, const VID &Y) const { return find(X) == find(Y); }
+
+inline Components ConnectedComponents::components() const {
+    Components out;
+    out.component.assign(bound, Components::NONE);
+    out.count = 0;
+    // Roots are the lowest vertex ids of their components, hence they are numbered first.
+    for (VID X = 0; X < bound; X++) {
+        if (!has_vertex(X)) continue;
+        const VID R = root(X);
+        out.component[X] = R == X ? out.count++ : out.component[R];
+    }
+    return out;
+}
+
+}  // namespace telegraph
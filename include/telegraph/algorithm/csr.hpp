@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <typeinfo>
+#include <vector>
+
+#include "../interface/abstract_graph.ipp"
+#include "utility.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Compressed sparse row snapshot of a graph, with optional edge weights.
+ *
+ * Rows are indexed by vertex id and hold the children of each vertex in
+ * storage order, missing vertex ids have empty rows. The snapshot is detached
+ * from the graph, hence algorithms can scan flat arrays without going through
+ * virtual cursors or attribute lookups, and it is not invalidated by later
+ * modifications of the graph.
+ */
+struct CSR {
+    //! Offset of each row in the targets, followed by the number of edges.
+    std::vector<std::size_t> offsets;
+    //! Target vertex id of each edge.
+    std::vector<VID> targets;
+    //! Weight of each edge, empty if unweighted.
+    std::vector<double> weights;
+
+    //! Default constructor for an empty CSR object.
+    CSR();
+
+    /**
+     * @brief Construct a new unweighted CSR snapshot of a given graph.
+     *
+     * @param G Given graph.
+     */
+    explicit CSR(const IGraph &G);
+
+    /**
+     * @brief Construct a new weighted CSR snapshot of a given graph.
+     *
+     * Weights are read once from the numeric edge attribute of the given key,
+     * of any integer or floating point type, characters included, and are
+     * converted to double. Edges without a value, or graphs without such
+     * attribute, weigh one.
+     *
+     * @param G Given graph.
+     * @param key Given edge attribute key.
+     * @throws std::bad_any_cast If the attribute is not numeric, e.g. bool or string.
+     */
+    CSR(const IGraph &G, const std::string &key);
+
+    //! Number of rows, i.e. the upper bound of the vertex ids.
+    inline std::size_t rows() const;
+
+    //! Number of edges.
+    inline std::size_t nonzeros() const;
+
+    /**
+     * @brief The transposed snapshot, i.e. the parents of each vertex.
+     *
+     * Weights are transposed along with their edges, each row is sorted.
+     *
+     * @return CSR Transposed snapshot.
+     */
+    inline CSR transpose() const;
+};
+
+}  // namespace telegraph
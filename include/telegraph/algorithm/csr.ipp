@@ -0,0 +1,102 @@
+#pragma once
+
+#include "csr.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Rows of vertices per parallel chunk.
+static constexpr std::size_t CSR_GRAIN = 1024;
+
+/**
+ * @brief Read the edge weights of a snapshot if the attribute is of a given type.
+ *
+ * @tparam T Attribute value type.
+ * @param G Given graph.
+ * @param key Given edge attribute key.
+ * @param out Given snapshot, with its structure already set.
+ * @return true If the attribute is of the given type,
+ * @return false Otherwise.
+ */
+template <typename T>
+inline bool read_weights(const AbstractGraph &G, const std::string &key, CSR &out) {
+    if (G.edge_property_type(key) != typeid(T)) return false;
+    const ConstEdgeProperty<T> W = G.edge_property<T>(key);
+    // Concurrent lookups do not modify the edge table.
+    parallel_for(out.rows(), CSR_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (VID X = b; X < e; X++) {
+            for (std::size_t j = out.offsets[X]; j < out.offsets[X + 1]; j++) {
+                const EID Y(X, out.targets[j]);
+                if (W.has(Y)) out.weights[j] = static_cast<double>(W[Y]);
+            }
+        }
+    });
+    return true;
+}
+
+//! Integer and floating point types read as weights.
+using WeightTypes = std::tuple<double, float, long double, char, signed char, unsigned char, short, unsigned short, int,
+                               unsigned, long, unsigned long, long long, unsigned long long>;
+
+//! Read the edge weights of a snapshot if the attribute is of any of the given types.
+template <typename... T>
+inline bool read_weights(const AbstractGraph &G, const std::string &key, CSR &out, std::tuple<T...>) {
+    return (read_weights<T>(G, key, out) || ...);
+}
+
+}  // namespace detail
+
+CSR::CSR() : offsets(1, 0) {}
+
+CSR::CSR(const IGraph &G) {
+    const std::size_t n = vertex_bound(G);
+    // Count the children of each vertex.
+    offsets.assign(n + 1, 0);
+    for (const VID &X : G.V()) offsets[X + 1] = G.out_degree(X);
+    for (std::size_t i = 0; i < n; i++) offsets[i + 1] += offsets[i];
+    targets.resize(offsets[n]);
+    // Fill the rows in parallel, each one is written by a single worker.
+    parallel_for(n, detail::CSR_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (VID X = b; X < e; X++) {
+            if (offsets[X] == offsets[X + 1]) continue;
+            std::size_t j = offsets[X];
+            for (const VID &Y : G.Ch(X)) targets[j++] = Y;
+        }
+    });
+}
+
+CSR::CSR(const IGraph &G, const std::string &key) : CSR(G) {
+    weights.assign(targets.size(), 1);
+    const auto *A = dynamic_cast<const AbstractGraph *>(&G);
+    if (A == nullptr || A->edge_property_type(key) == typeid(void)) return;
+    // Convert any integer or floating point attribute type.
+    if (!detail::read_weights(*A, key, *this, detail::WeightTypes())) throw std::bad_any_cast();
+}
+
+inline std::size_t CSR::rows() const { return offsets.size() - 1; }
+
+inline std::size_t CSR::nonzeros() const { return targets.size(); }
+
+inline CSR CSR::transpose() const {
+    const std::size_t n = rows();
+    CSR out;
+    // Count the parents of each vertex.
+    out.offsets.assign(n + 1, 0);
+    for (const VID &Y : targets) out.offsets[Y + 1]++;
+    for (std::size_t i = 0; i < n; i++) out.offsets[i + 1] += out.offsets[i];
+    out.targets.resize(targets.size());
+    if (!weights.empty()) out.weights.resize(weights.size());
+    // Scatter the edges, rows are filled in increasing order of source.
+    std::vector<std::size_t> next(out.offsets.begin(), out.offsets.end() - 1);
+    for (VID X = 0; X < n; X++) {
+        for (std::size_t j = offsets[X]; j < offsets[X + 1]; j++) {
+            const std::size_t k = next[targets[j]]++;
+            out.targets[k] = X;
+            if (!weights.empty()) out.weights[k] = weights[j];
+        }
+    }
+    return out;
+}
+
+}  // namespace telegraph
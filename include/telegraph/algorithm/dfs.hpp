@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "../interface/exceptions.hpp"
+#include "utility.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Depth-first search forest, indexed by vertex id.
+ *
+ * Discovery and finish times share a single clock, so that a vertex is a
+ * descendant of another if and only if its interval is nested in the other one.
+ */
+struct DFSTree {
+    //! Time of the unreached vertices.
+    static constexpr std::size_t INF = std::numeric_limits<std::size_t>::max();
+    //! Parent of the unreached vertices.
+    static constexpr VID NONE = std::numeric_limits<VID>::max();
+
+    //! Discovery time of each vertex, INF if unreached.
+    std::vector<std::size_t> discovery;
+    //! Finish time of each vertex, INF if unreached.
+    std::vector<std::size_t> finish;
+    //! Parent of each vertex, roots are their own parents, NONE if unreached.
+    std::vector<VID> parent;
+};
+
+/**
+ * @brief Iterative depth-first search from a given vertex.
+ *
+ * The search keeps an explicit stack of adjacency cursors over the container
+ * storage, hence its depth is bounded by memory only. Children are visited in
+ * storage order and edges are followed from parent to child.
+ *
+ * @param G Given graph.
+ * @param X Given source vertex id.
+ * @return DFSTree Discovery times, finish times and parents, indexed by vertex id.
+ * @throws NOT_DEFINED If the source vertex is not defined.
+ */
+inline DFSTree dfs(const IGraph &G, const VID &X);
+
+/**
+ * @brief Iterative depth-first search of the whole graph.
+ *
+ * Roots are taken in vertex order among the vertices not reached yet.
+ *
+ * @param G Given graph.
+ * @return DFSTree Discovery times, finish times and parents, indexed by vertex id.
+ */
+inline DFSTree dfs(const IGraph &G);
+
+/**
+ * @brief Topological sort of the vertices.
+ *
+ * Vertices are sorted by decreasing finish time of an iterative depth-first search.
+ *
+ * @param G Given graph.
+ * @return std::vector<VID> Vertex ids, each one before its children.
+ * @throws NOT_ACYCLIC If the graph has a cycle.
+ */
+inline std::vector<VID> topological_sort(const IGraph &G);
+
+/**
+ * @brief A graph is acyclic if it has no directed cycles.
+ *
+ * The search stops at the first back edge.
+ *
+ * @param G Given graph.
+ * @return true If the graph is acyclic,
+ * @return false Otherwise.
+ */
+inline bool is_acyclic(const IGraph &G);
+
+}  // namespace telegraph
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "dfs.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Vertex state during a depth-first search.
+enum Color : std::uint8_t { WHITE, GRAY, BLACK };
+
+//! Stack frame of a depth-first search.
+struct DFSFrame {
+    //! Visited vertex id.
+    VID X;
+    //! Cursor over the children of the vertex.
+    IGraph::AdjacencyIterator it;
+};
+
+/**
+ * @brief Iterative depth-first search from a given root.
+ *
+ * @tparam D Discover callback typename, callable as discover(Y, Z) when Y is reached from Z.
+ * @tparam F Finish callback typename, callable as finish(Y) when Y has no children left.
+ * @tparam R Revisit callback typename, callable as revisit(Z, Y) on each edge from Z to an
+ * already discovered Y, the search stops if false.
+ * @param G Given graph.
+ * @param X Given root vertex id, *white*.
+ * @param color Given vertex colors, indexed by vertex id.
+ * @param stack Given empty stack, reused across roots.
+ * @return true If the search has been completed,
+ * @return false If it has been stopped by the revisit callback.
+ */
+template <typename D, typename F, typename R>
+inline bool dfs_visit(const IGraph &G, const VID &X, std::vector<Color> &color, std::vector<DFSFrame> &stack,
+                      const D &discover, const F &finish, const R &revisit) {
+    // Past-the-end iterators compare equal regardless of their vertex.
+    const IGraph::AdjacencyIterator end(&G, IGraph::AdjacencyIterator::CHILDREN, X, true);
+    color[X] = GRAY;
+    discover(X, X);
+    stack.push_back({X, G.Ch(X).begin()});
+    while (!stack.empty()) {
+        DFSFrame &f = stack.back();
+        // Finish the vertex once its children are exhausted.
+        if (f.it == end) {
+            color[f.X] = BLACK;
+            finish(f.X);
+            stack.pop_back();
+            continue;
+        }
+        // Advance the cursor before pushing, which invalidates the frame.
+        const VID Z = f.X, Y = *f.it;
+        ++f.it;
+        if (color[Y] == WHITE) {
+            color[Y] = GRAY;
+            discover(Y, Z);
+            stack.push_back({Y, G.Ch(Y).begin()});
+        } else if (!revisit(Z, Y)) {
+            stack.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace detail
+
+inline DFSTree dfs(const IGraph &G, const VID &X) {
+    if (!G.has_vertex(X)) throw NOT_DEFINED(X);
+    const std::size_t n = vertex_bound(G);
+    DFSTree out;
+    out.discovery.assign(n, DFSTree::INF);
+    out.finish.assign(n, DFSTree::INF);
+    out.parent.assign(n, DFSTree::NONE);
+    std::vector<detail::Color> color(n, detail::WHITE);
+    std::vector<detail::DFSFrame> stack;
+    std::size_t t = 0;
+    detail::dfs_visit(
+        G, X, color, stack,
+        [&](const VID &Y, const VID &Z) {
+            out.discovery[Y] = t++;
+            out.parent[Y] = Z;
+        },
+        [&](const VID &Y) { out.finish[Y] = t++; }, [](const VID &, const VID &) { return true; });
+    return out;
+}
+
+inline DFSTree dfs(const IGraph &G) {
+    const std::size_t n = vertex_bound(G);
+    DFSTree out;
+    out.discovery.assign(n, DFSTree::INF);
+    out.finish.assign(n, DFSTree::INF);
+    out.parent.assign(n, DFSTree::NONE);
+    std::vector<detail::Color> color(n, detail::WHITE);
+    std::vector<detail::DFSFrame> stack;
+    std::size_t t = 0;
+    for (const VID &X : G.V()) {
+        if (color[X] != detail::WHITE) continue;
+        detail::dfs_visit(
+            G, X, color, stack,
+            [&](const VID &Y, const VID &Z) {
+                out.discovery[Y] = t++;
+                out.parent[Y] = Z;
+            },
+            [&](const VID &Y) { out.finish[Y] = t++; }, [](const VID &, const VID &) { return true; });
+    }
+    return out;
+}
+
+inline std::vector<VID> topological_sort(const IGraph &G) {
+    const std::size_t n = vertex_bound(G);
+    std::vector<VID> out;
+    out.reserve(G.order());
+    std::vector<detail::Color> color(n, detail::WHITE);
+    std::vector<detail::DFSFrame> stack;
+    for (const VID &X : G.V()) {
+        if (color[X] != detail::WHITE) continue;
+        // Collect the vertices by increasing finish time, stopping at the first back edge.
+        bool acyclic = detail::dfs_visit(
+            G, X, color, stack, [](const VID &, const VID &) {}, [&](const VID &Y) { out.push_back(Y); },
+            [&](const VID &, const VID &Y) { return color[Y] != detail::GRAY; });
+        if (!acyclic) throw NOT_ACYCLIC;
+    }
+    std::reverse(out.begin(), out.end());
+    return out;
+}
+
+inline bool is_acyclic(const IGraph &G) {
+    const std::size_t n = vertex_bound(G);
+    std::vector<detail::Color> color(n, detail::WHITE);
+    std::vector<detail::DFSFrame> stack;
+    for (const VID &X : G.V()) {
+        if (color[X] != detail::WHITE) continue;
+        bool acyclic = detail::dfs_visit(
+            G, X, color, stack, [](const VID &, const VID &) {}, [](const VID &) {},
+            [&](const VID &, const VID &Y) { return color[Y] != detail::GRAY; });
+        if (!acyclic) return false;
+    }
+    return true;
+}
+
+}  // namespace telegraph
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "csr.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Weisfeiler-Lehman hash of the graph, invariant under vertex relabeling.
+ *
+ * Each vertex starts from the hash of its label, if any, then each round
+ * refines its color with the multisets of the colors of its children and of
+ * its parents, as sums of mixed hashes. Vertices are refined in parallel over
+ * a CSR snapshot and its transpose. The result combines the order, the size
+ * and the multiset of the final colors, hence isomorphic graphs, with the
+ * same vertex labels, have the same hash. The converse does not hold, e.g.
+ * for regular graphs of the same degree, hence equal hashes should be
+ * confirmed before merging states.
+ *
+ * @param G Given graph.
+ * @param iterations Given number of refinement rounds.
+ * @param labels Given whether to start from the vertex labels or from a uniform color.
+ * @return std::size_t Invariant hash.
+ */
+inline std::size_t weisfeiler_lehman_hash(const IGraph &G, std::size_t iterations = 3, bool labels = true);
+
+}  // namespace telegraph
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "invariant.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Vertices per parallel chunk of a refinement round.
+static constexpr std::size_t WL_GRAIN = 1024;
+
+}  // namespace detail
+
+inline std::size_t weisfeiler_lehman_hash(const IGraph &G, std::size_t iterations, bool labels) {
+    const CSR C(G);
+    const CSR T = C.transpose();
+    const std::size_t n = C.rows();
+    // Initialize the colors from the vertex labels, if any.
+    std::vector<std::size_t> x(n, 0), y(n, 0);
+    const AbstractGraph *H = labels ? dynamic_cast<const AbstractGraph *>(&G) : nullptr;
+    for (const VID &X : G.V()) {
+        x[X] = mix_hash(H && H->has_label(X) ? std::hash<VLB>{}(H->get_label(X)) : 0);
+    }
+    // Refine the colors with the multisets of the colors of the neighbors, children and parents apart.
+    for (std::size_t k = 0; k < iterations; k++) {
+        parallel_for(n, detail::WL_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+            for (VID X = b; X < e; X++) {
+                std::size_t ch = 0, pa = 0;
+                for (std::size_t j = C.offsets[X]; j < C.offsets[X + 1]; j++) ch += mix_hash(x[C.targets[j]]);
+                for (std::size_t j = T.offsets[X]; j < T.offsets[X + 1]; j++) pa += mix_hash(x[T.targets[j]]);
+                std::size_t h = x[X];
+                boost::hash_combine(h, ch);
+                boost::hash_combine(h, pa);
+                y[X] = h;
+            }
+        });
+        x.swap(y);
+    }
+    // Combine the multiset of the colors of the vertices.
+    std::size_t sum = 0;
+    for (const VID &X : G.V()) sum += mix_hash(x[X]);
+    std::size_t seed = 0;
+    boost::hash_combine(seed, G.order());
+    boost::hash_combine(seed, G.size());
+    boost::hash_combine(seed, sum);
+    return seed;
+}
+
+}  // namespace telegraph
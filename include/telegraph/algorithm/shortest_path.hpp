@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../interface/exceptions.hpp"
+#include "csr.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Single-source shortest paths tree, indexed by vertex id.
+ */
+struct ShortestPaths {
+    //! Distance of the unreached vertices.
+    static constexpr double INF = std::numeric_limits<double>::infinity();
+    //! Parent of the unreached vertices.
+    static constexpr VID NONE = std::numeric_limits<VID>::max();
+
+    //! Weight of the shortest path from the source to each vertex, INF if unreached.
+    std::vector<double> distance;
+    //! Parent of each vertex on a shortest path, the source is its own parent, NONE if unreached.
+    std::vector<VID> parent;
+};
+
+/**
+ * @brief Dijkstra's single-source shortest paths.
+ *
+ * Weights are snapshotted once from the numeric edge attribute of the given
+ * key, or default to one, and the frontier is kept in a 4-ary heap with
+ * decrease-key, which is shallower and more cache-friendly than a binary heap.
+ *
+ * @param G Given graph.
+ * @param X Given source vertex id.
+ * @param key Given edge weight attribute key.
+ * @return ShortestPaths Distances and parents, indexed by vertex id.
+ * @throws NOT_DEFINED If the source vertex is not defined.
+ * @throws NEGATIVE_WEIGHT If an edge has a negative weight.
+ */
+inline ShortestPaths dijkstra(const IGraph &G, const VID &X, const std::string &key = "weight");
+
+/**
+ * @brief Parallel delta-stepping single-source shortest paths.
+ *
+ * Vertices are grouped in buckets of width *delta* by tentative distance.
+ * Buckets are settled in increasing order, relaxing the light edges (not
+ * heavier than *delta*) of a bucket in parallel until it is empty, then its
+ * heavy edges once. Parents are recovered from the final distances.
+ *
+ * @param G Given graph.
+ * @param X Given source vertex id.
+ * @param delta Given bucket width, zero to derive it from the maximum weight and the average degree.
+ * @param key Given edge weight attribute key.
+ * @return ShortestPaths Distances and parents, indexed by vertex id.
+ * @throws NOT_DEFINED If the source vertex is not defined.
+ * @throws NEGATIVE_WEIGHT If an edge has a negative weight.
+ */
+inline ShortestPaths delta_stepping(const IGraph &G, const VID &X, double delta = 0,
+                                    const std::string &key = "weight");
+
+}  // namespace telegraph
@@ -0,0 +1,268 @@
+#pragma once
+
+#include "shortest_path.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Vertices per parallel chunk of a delta-stepping phase.
+static constexpr std::size_t SSSP_GRAIN = 256;
+
+/**
+ * @brief Indexed d-ary min-heap of vertex ids, keyed by an external array.
+ *
+ * @tparam D Heap arity.
+ */
+template <std::size_t D>
+class IndexedHeap {
+   protected:
+    //! Position of the vertex ids not in the heap.
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    //! Key of each vertex id.
+    const std::vector<double> &key;
+    //! Heap of vertex ids.
+    std::vector<VID> heap;
+    //! Position of each vertex id in the heap, npos if none.
+    std::vector<std::size_t> pos;
+
+    //! Sift up the vertex id at a given position.
+    inline void up(std::size_t i) {
+        const VID X = heap[i];
+        for (std::size_t p; i > 0 && key[heap[p = (i - 1) / D]] > key[X]; i = p) {
+            heap[i] = heap[p];
+            pos[heap[i]] = i;
+        }
+        heap[i] = X;
+        pos[X] = i;
+    }
+
+    //! Sift down the vertex id at a given position.
+    inline void down(std::size_t i) {
+        const VID X = heap[i];
+        const std::size_t n = heap.size();
+        for (std::size_t c = i * D + 1; c < n; c = i * D + 1) {
+            // Find the smallest child among the D contiguous ones.
+            std::size_t b = c;
+            for (std::size_t j = c + 1; j < std::min(c + D, n); j++) {
+                if (key[heap[j]] < key[heap[b]]) b = j;
+            }
+            if (key[heap[b]] >= key[X]) break;
+            heap[i] = heap[b];
+            pos[heap[i]] = i;
+            i = b;
+        }
+        heap[i] = X;
+        pos[X] = i;
+    }
+
+   public:
+    /**
+     * @brief Construct a new empty Indexed Heap object.
+     *
+     * @param key Given key of each vertex id.
+     */
+    explicit IndexedHeap(const std::vector<double> &key) : key(key), pos(key.size(), npos) {}
+
+    //! Whether the heap is empty.
+    inline bool empty() const { return heap.empty(); }
+
+    /**
+     * @brief Insert a vertex id, or restore the heap after its key decreased.
+     *
+     * @param X Given vertex id.
+     */
+    inline void push(const VID &X) {
+        if (pos[X] == npos) {
+            heap.push_back(X);
+            pos[X] = heap.size() - 1;
+        }
+        up(pos[X]);
+    }
+
+    /**
+     * @brief Remove the vertex id with the smallest key.
+     *
+     * @return VID Removed vertex id.
+     */
+    inline VID pop() {
+        const VID X = heap.front();
+        pos[X] = npos;
+        heap.front() = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) down(0);
+        return X;
+    }
+};
+
+/**
+ * @brief Check that every weight of a snapshot is non-negative.
+ *
+ * @param C Given weighted snapshot.
+ * @throws NEGATIVE_WEIGHT If an edge has a negative weight.
+ */
+inline void check_weights(const CSR &C) {
+    for (VID X = 0; X < C.rows(); X++) {
+        for (std::size_t j = C.offsets[X]; j < C.offsets[X + 1]; j++) {
+            if (C.weights[j] < 0) throw NEGATIVE_WEIGHT(X, C.targets[j]);
+        }
+    }
+}
+
+}  // namespace detail
+
+inline ShortestPaths dijkstra(const IGraph &G, const VID &X, const std::string &key) {
+    if (!G.has_vertex(X)) throw NOT_DEFINED(X);
+    // Snapshot the weights once.
+    const CSR C(G, key);
+    detail::check_weights(C);
+    // Initialize the tree.
+    ShortestPaths out;
+    out.distance.assign(C.rows(), ShortestPaths::INF);
+    out.parent.assign(C.rows(), ShortestPaths::NONE);
+    out.distance[X] = 0;
+    out.parent[X] = X;
+    // Settle the closest vertex, relaxing its edges.
+    detail::IndexedHeap<4> Q(out.distance);
+    Q.push(X);
+    while (!Q.empty()) {
+        const VID Y = Q.pop();
+        const double d = out.distance[Y];
+        for (std::size_t j = C.offsets[Y]; j < C.offsets[Y + 1]; j++) {
+            const VID &Z = C.targets[j];
+            if (d + C.weights[j] < out.distance[Z]) {
+                out.distance[Z] = d + C.weights[j];
+                out.parent[Z] = Y;
+                Q.push(Z);
+            }
+        }
+    }
+    return out;
+}
+
+inline ShortestPaths delta_stepping(const IGraph &G, const VID &X, double delta, const std::string &key) {
+    if (!G.has_vertex(X)) throw NOT_DEFINED(X);
+    // Snapshot the weights once.
+    CSR C(G, key);
+    detail::check_weights(C);
+    const std::size_t n = C.rows();
+    // Derive the bucket width from the maximum weight and the average degree.
+    if (!(delta > 0)) {
+        double w = 0;
+        for (const double &v : C.weights) w = std::max(w, v);
+        delta = w / std::max(1.0, static_cast<double>(C.nonzeros()) / std::max<std::size_t>(1, G.order()));
+        if (!(delta > 0)) delta = 1;
+    }
+    // Move the light edges to the front of each row.
+    std::vector<std::size_t> split(n);
+    parallel_for(n, detail::CSR_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (VID Y = b; Y < e; Y++) {
+            std::size_t i = C.offsets[Y];
+            for (std::size_t j = i; j < C.offsets[Y + 1]; j++) {
+                if (C.weights[j] > delta) continue;
+                std::swap(C.targets[i], C.targets[j]);
+                std::swap(C.weights[i], C.weights[j]);
+                i++;
+            }
+            split[Y] = i;
+        }
+    });
+    // Tentative distances, lowered concurrently.
+    std::vector<std::atomic<double>> dist(n);
+    for (auto &d : dist) d.store(ShortestPaths::INF, std::memory_order_relaxed);
+    dist[X].store(0, std::memory_order_relaxed);
+    auto relax = [&](const VID &Y, double d) {
+        double e = dist[Y].load(std::memory_order_relaxed);
+        while (d < e) {
+            if (dist[Y].compare_exchange_weak(e, d, std::memory_order_relaxed)) return true;
+        }
+        return false;
+    };
+    auto bucket = [&](const VID &Y) {
+        return static_cast<std::size_t>(std::min(dist[Y].load(std::memory_order_relaxed) / delta, 1e18));
+    };
+    // Buckets of vertices, each worker collecting its own improved vertices.
+    std::map<std::size_t, std::vector<VID>> B;
+    std::vector<std::vector<VID>> improved(concurrency());
+    // Epoch of the last scan of each vertex, to skip repeated entries.
+    std::vector<std::size_t> seen(n, 0);
+    std::size_t epoch = 0;
+    auto merge = [&]() {
+        epoch++;
+        for (auto &I : improved) {
+            for (const VID &Y : I) {
+                if (seen[Y] == epoch) continue;
+                seen[Y] = epoch;
+                B[bucket(Y)].push_back(Y);
+            }
+            I.clear();
+        }
+    };
+    // Relax the edges of a given range of each vertex in parallel.
+    auto step = [&](const std::vector<VID> &F, bool light) {
+        parallel_for(F.size(), detail::SSSP_GRAIN, [&](std::size_t b, std::size_t e, std::size_t t) {
+            for (std::size_t i = b; i < e; i++) {
+                const VID &Y = F[i];
+                const double d = dist[Y].load(std::memory_order_relaxed);
+                const std::size_t first = light ? C.offsets[Y] : split[Y];
+                const std::size_t last = light ? split[Y] : C.offsets[Y + 1];
+                for (std::size_t j = first; j < last; j++) {
+                    if (relax(C.targets[j], d + C.weights[j])) improved[t].push_back(C.targets[j]);
+                }
+            }
+        });
+        merge();
+    };
+    B[0].push_back(X);
+    while (!B.empty()) {
+        const std::size_t k = B.begin()->first;
+        // Settle the current bucket through its light edges, until it stays empty.
+        std::vector<VID> R;
+        for (auto i = B.find(k); i != B.end(); i = B.find(k)) {
+            std::vector<VID> F = std::move(i->second);
+            B.erase(i);
+            // Drop the stale and the repeated entries.
+            epoch++;
+            F.erase(std::remove_if(F.begin(), F.end(),
+                                   [&](const VID &Y) {
+                                       if (seen[Y] == epoch || bucket(Y) != k) return true;
+                                       seen[Y] = epoch;
+                                       return false;
+                                   }),
+                    F.end());
+            step(F, true);
+            R.insert(R.end(), F.begin(), F.end());
+        }
+        // Relax the heavy edges of the settled vertices once.
+        epoch++;
+        R.erase(std::remove_if(R.begin(), R.end(),
+                               [&](const VID &Y) {
+                                   if (seen[Y] == epoch) return true;
+                                   seen[Y] = epoch;
+                                   return false;
+                               }),
+                R.end());
+        step(R, false);
+    }
+    // Initialize the tree.
+    ShortestPaths out;
+    out.distance.resize(n);
+    for (std::size_t i = 0; i < n; i++) out.distance[i] = dist[i].load(std::memory_order_relaxed);
+    out.parent.assign(n, ShortestPaths::NONE);
+    out.parent[X] = X;
+    // Recover the parents through the tight edges, in breadth-first order from the source.
+    std::vector<VID> Q = {X};
+    for (std::size_t i = 0; i < Q.size(); i++) {
+        const VID Y = Q[i];
+        for (std::size_t j = C.offsets[Y]; j < C.offsets[Y + 1]; j++) {
+            const VID &Z = C.targets[j];
+            if (out.parent[Z] != ShortestPaths::NONE || out.distance[Y] + C.weights[j] != out.distance[Z]) continue;
+            out.parent[Z] = Y;
+            Q.push_back(Z);
+        }
+    }
+    return out;
+}
+
+}  // namespace telegraph
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "components.ipp"
+#include "csr.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Minimum spanning forest, as a list of edges.
+ */
+struct SpanningForest {
+    //! Edges of the forest, in the same direction as in the graph.
+    std::vector<EID> edges;
+    //! Total weight of the edges.
+    double weight;
+};
+
+/**
+ * @brief Kruskal's minimum spanning forest.
+ *
+ * Edge directions are ignored and self loops are skipped. Edges are sorted
+ * by weight with a radix sort, then merged serially in increasing order of
+ * weight through a union-find forest, ties broken by order in the graph.
+ *
+ * @param G Given graph.
+ * @param key Given edge weight attribute key, edges without a value weigh one.
+ * @return SpanningForest Edges of the forest, in increasing order of weight.
+ * @throws std::bad_any_cast If the attribute is not numeric.
+ */
+inline SpanningForest kruskal(const IGraph &G, const std::string &key = "weight");
+
+/**
+ * @brief Kruskal's minimum spanning forest, with the given edge weights.
+ *
+ * @param G Given graph.
+ * @param weights Given weight of each edge, in the order of the edges range.
+ * @return SpanningForest Edges of the forest, in increasing order of weight.
+ * @throws std::invalid_argument If the number of weights differs from the number of edges.
+ * @see kruskal
+ */
+inline SpanningForest kruskal(const IGraph &G, const std::vector<double> &weights);
+
+/**
+ * @brief Parallel Borůvka's minimum spanning forest.
+ *
+ * Edge directions are ignored and self loops are skipped. Each round finds
+ * the lightest edge leaving each component in parallel, ties broken by order
+ * in the graph, then merges the components along those edges through a
+ * lock-free union-find forest and drops the edges inside the components.
+ * Each round at least halves the number of components.
+ *
+ * @param G Given graph.
+ * @param key Given edge weight attribute key, edges without a value weigh one.
+ * @return SpanningForest Edges of the forest, in the order of the edges range.
+ * @throws std::bad_any_cast If the attribute is not numeric.
+ */
+inline SpanningForest boruvka(const IGraph &G, const std::string &key = "weight");
+
+/**
+ * @brief Parallel Borůvka's minimum spanning forest, with the given edge weights.
+ *
+ * @param G Given graph.
+ * @param weights Given weight of each edge, in the order of the edges range.
+ * @return SpanningForest Edges of the forest, in the order of the edges range.
+ * @throws std::invalid_argument If the number of weights differs from the number of edges.
+ * @see boruvka
+ */
+inline SpanningForest boruvka(const IGraph &G, const std::vector<double> &weights);
+
+/**
+ * @brief Minimum spanning forest, with Borůvka's algorithm on large graphs and Kruskal's otherwise.
+ *
+ * @param G Given graph.
+ * @param key Given edge weight attribute key, edges without a value weigh one.
+ * @return SpanningForest Edges of the forest.
+ * @throws std::bad_any_cast If the attribute is not numeric.
+ */
+inline SpanningForest minimum_spanning_forest(const IGraph &G, const std::string &key = "weight");
+
+/**
+ * @brief Minimum spanning forest, with the given edge weights.
+ *
+ * @param G Given graph.
+ * @param weights Given weight of each edge, in the order of the edges range.
+ * @return SpanningForest Edges of the forest.
+ * @throws std::invalid_argument If the number of weights differs from the number of edges.
+ * @see minimum_spanning_forest
+ */
+inline SpanningForest minimum_spanning_forest(const IGraph &G, const std::vector<double> &weights);
+
+/**
+ * @brief Copy of a graph with a subset of its edges.
+ *
+ * Vertices, with their labels and attributes, are copied as they are, as
+ * well as the labels and attributes of the kept edges, e.g. to turn a
+ * spanning forest into a graph of the same container type.
+ *
+ * @tparam T Graph typename.
+ * @param G Given graph.
+ * @param E Given edges to keep, edges not in the graph are ignored.
+ * @return T Graph with the given edges only.
+ */
+template <typename T>
+inline T edge_subgraph(const T &G, const std::vector<EID> &E);
+
+}  // namespace telegraph
@@ -0,0 +1,234 @@
+#pragma once
+
+#include "spanning_forest.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Edges or vertices per parallel chunk of a Borůvka round.
+static constexpr std::size_t MSF_GRAIN = 4096;
+//! Number of edges above which Borůvka's algorithm is preferred.
+static constexpr std::size_t BORUVKA_EDGES = 1 << 16;
+
+/**
+ * @brief Flat weighted edge list, in the order of the edges range.
+ */
+struct WeightedEdges {
+    //! Upper bound of the vertex ids.
+    std::size_t n;
+    //! Source vertex id of each edge.
+    std::vector<VID> source;
+    //! Target vertex id of each edge.
+    std::vector<VID> target;
+    //! Weight of each edge.
+    std::vector<double> weight;
+};
+
+//! Weighted edge list of a graph, read from a numeric edge attribute.
+inline WeightedEdges weighted_edges(const IGraph &G, const std::string &key) {
+    CSR C(G, key);
+    WeightedEdges out;
+    out.n = C.rows();
+    out.source.resize(C.nonzeros());
+    for (VID X = 0; X < C.rows(); X++) {
+        std::fill(out.source.begin() + C.offsets[X], out.source.begin() + C.offsets[X + 1], X);
+    }
+    out.target = std::move(C.targets);
+    out.weight = std::move(C.weights);
+    return out;
+}
+
+//! Weighted edge list of a graph, with the given edge weights.
+inline WeightedEdges weighted_edges(const IGraph &G, const std::vector<double> &weights) {
+    if (weights.size() != G.size()) throw std::invalid_argument("Weights must match the number of edges.");
+    WeightedEdges out;
+    out.n = vertex_bound(G);
+    out.source.reserve(G.size());
+    out.target.reserve(G.size());
+    for (const EID &X : G.E()) {
+        out.source.push_back(X.first);
+        out.target.push_back(X.second);
+    }
+    out.weight = weights;
+    return out;
+}
+
+/**
+ * @brief Order-preserving unsigned key of a weight.
+ *
+ * Non-negative weights get the sign bit set, negative ones get every bit
+ * flipped, so that unsigned comparison matches floating point comparison.
+ *
+ * @param w Given weight.
+ * @return std::uint64_t Radix key.
+ */
+inline std::uint64_t radix_key(double w) {
+    static constexpr std::uint64_t SIGN = std::uint64_t(1) << 63;
+    std::uint64_t b;
+    std::memcpy(&b, &w, sizeof(b));
+    return (b & SIGN) ? ~b : b | SIGN;
+}
+
+/**
+ * @brief Stable least significant digit radix sort of the indices of a weight sequence.
+ *
+ * Each pass sorts by one byte of the keys, passes where every key has the
+ * same byte are skipped, e.g. the exponent bytes of weights of similar size.
+ *
+ * @param weights Given weights.
+ * @return std::vector<std::size_t> Indices in increasing order of weight.
+ */
+inline std::vector<std::size_t> radix_sort(const std::vector<double> &weights) {
+    const std::size_t m = weights.size();
+    std::vector<std::uint64_t> key(m), other_key(m);
+    std::vector<std::size_t> index(m), other_index(m);
+    for (std::size_t i = 0; i < m; i++) key[i] = radix_key(weights[i]);
+    std::iota(index.begin(), index.end(), 0);
+    for (unsigned shift = 0; shift < 64; shift += 8) {
+        std::size_t count[257] = {0};
+        for (const std::uint64_t &k : key) count[((k >> shift) & 0xFF) + 1]++;
+        if (std::find(count + 1, count + 257, m) != count + 257) continue;
+        for (std::size_t d = 0; d < 256; d++) count[d + 1] += count[d];
+        for (std::size_t i = 0; i < m; i++) {
+            const std::size_t j = count[(key[i] >> shift) & 0xFF]++;
+            other_key[j] = key[i];
+            other_index[j] = index[i];
+        }
+        key.swap(other_key);
+        index.swap(other_index);
+    }
+    return index;
+}
+
+//! Lock-free union-find forest of singletons.
+inline std::vector<std::atomic<VID>> singletons(std::size_t n) {
+    std::vector<std::atomic<VID>> out(n);
+    for (VID X = 0; X < n; X++) out[X].store(X, std::memory_order_relaxed);
+    return out;
+}
+
+//! Kruskal's algorithm on a weighted edge list.
+inline SpanningForest kruskal(const WeightedEdges &E) {
+    std::vector<std::atomic<VID>> parent = singletons(E.n);
+    SpanningForest out;
+    out.weight = 0;
+    for (const std::size_t &i : radix_sort(E.weight)) {
+        // A forest has fewer edges than vertices.
+        if (out.edges.size() + 1 >= E.n) break;
+        if (!link_roots(parent, E.source[i], E.target[i])) continue;
+        out.edges.emplace_back(E.source[i], E.target[i]);
+        out.weight += E.weight[i];
+    }
+    return out;
+}
+
+//! Borůvka's algorithm on a weighted edge list.
+inline SpanningForest boruvka(const WeightedEdges &E) {
+    static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+    std::vector<std::atomic<VID>> parent = singletons(E.n);
+    // Lightest edge leaving each component, by index, NONE if none.
+    std::vector<std::atomic<std::size_t>> best(E.n);
+    for (auto &b : best) b.store(NONE, std::memory_order_relaxed);
+    // Total order of the edges, ties broken by index, so that the lightest edges never close a cycle.
+    auto lighter = [&](const std::size_t &i, const std::size_t &j) {
+        return j == NONE || E.weight[i] < E.weight[j] || (E.weight[i] == E.weight[j] && i < j);
+    };
+    // Edges between different components, self loops excluded.
+    std::vector<std::size_t> active;
+    for (std::size_t i = 0; i < E.source.size(); i++) {
+        if (E.source[i] != E.target[i]) active.push_back(i);
+    }
+    std::vector<std::vector<std::size_t>> picked(concurrency());
+    std::vector<char> inner;
+    while (!active.empty()) {
+        // Find the lightest edge leaving each component.
+        parallel_for(active.size(), MSF_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+            for (std::size_t k = b; k < e; k++) {
+                const std::size_t &i = active[k];
+                for (const VID &R : {find_root(parent, E.source[i]), find_root(parent, E.target[i])}) {
+                    std::size_t j = best[R].load(std::memory_order_relaxed);
+                    while (lighter(i, j) && !best[R].compare_exchange_weak(j, i, std::memory_order_relaxed)) {
+                    }
+                }
+            }
+        });
+        // Merge the components along them, an edge picked by both its components is merged once.
+        parallel_for(E.n, MSF_GRAIN, [&](std::size_t b, std::size_t e, std::size_t t) {
+            for (VID R = b; R < e; R++) {
+                const std::size_t i = best[R].load(std::memory_order_relaxed);
+                if (i == NONE) continue;
+                best[R].store(NONE, std::memory_order_relaxed);
+                if (link_roots(parent, E.source[i], E.target[i])) picked[t].push_back(i);
+            }
+        });
+        // Drop the edges inside the merged components.
+        inner.assign(active.size(), 0);
+        parallel_for(active.size(), MSF_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+            for (std::size_t k = b; k < e; k++) {
+                const std::size_t &i = active[k];
+                inner[k] = find_root(parent, E.source[i]) == find_root(parent, E.target[i]);
+            }
+        });
+        std::size_t k = 0;
+        for (std::size_t j = 0; j < active.size(); j++) {
+            if (!inner[j]) active[k++] = active[j];
+        }
+        active.resize(k);
+    }
+    // Collect the picked edges in the order of the edges range.
+    std::vector<std::size_t> I;
+    for (const auto &P : picked) I.insert(I.end(), P.begin(), P.end());
+    std::sort(I.begin(), I.end());
+    SpanningForest out;
+    out.weight = 0;
+    for (const std::size_t &i : I) {
+        out.edges.emplace_back(E.source[i], E.target[i]);
+        out.weight += E.weight[i];
+    }
+    return out;
+}
+
+}  // namespace detail
+
+inline SpanningForest kruskal(const IGraph &G, const std::string &key) {
+    return detail::kruskal(detail::weighted_edges(G, key));
+}
+
+inline SpanningForest kruskal(const IGraph &G, const std::vector<double> &weights) {
+    return detail::kruskal(detail::weighted_edges(G, weights));
+}
+
+inline SpanningForest boruvka(const IGraph &G, const std::string &key) {
+    return detail::boruvka(detail::weighted_edges(G, key));
+}
+
+inline SpanningForest boruvka(const IGraph &G, const std::vector<double> &weights) {
+    return detail::boruvka(detail::weighted_edges(G, weights));
+}
+
+inline SpanningForest minimum_spanning_forest(const IGraph &G, const std::string &key) {
+    if (G.size() < detail::BORUVKA_EDGES || concurrency() == 1) return kruskal(G, key);
+    return boruvka(G, key);
+}
+
+inline SpanningForest minimum_spanning_forest(const IGraph &G, const std::vector<double> &weights) {
+    if (G.size() < detail::BORUVKA_EDGES || concurrency() == 1) return kruskal(G, weights);
+    return boruvka(G, weights);
+}
+
+template <typename T>
+inline T edge_subgraph(const T &G, const std::vector<EID> &E) {
+    std::vector<EID> keep(E);
+    std::sort(keep.begin(), keep.end());
+    // Delete the other edges from a copy, which drops their labels and attributes only.
+    std::vector<EID> drop;
+    for (const EID &X : G.E()) {
+        if (!std::binary_search(keep.begin(), keep.end(), X)) drop.push_back(X);
+    }
+    T out(G);
+    out.del_edges(drop.begin(), drop.end());
+    return out;
+}
+
+}  // namespace telegraph
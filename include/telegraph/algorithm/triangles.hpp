@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "../container/dense_graph.ipp"
+#include "csr.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Number of triangles of the graph.
+ *
+ * Triangles are counted on the underlying undirected simple graph, i.e.
+ * edge directions are ignored, as well as self loops. Each triangle is
+ * counted once, from its lowest vertex.
+ *
+ * If the graph is a DenseGraph, neighborhoods are intersected as bit rows
+ * with popcount. Otherwise, they are intersected as sorted neighbor lists
+ * with a branch-free merge, after orienting each edge from the lower to the
+ * higher degree vertex, so that high-degree vertices never scan their whole
+ * neighborhood. Vertices are processed in parallel.
+ *
+ * @param G Given graph.
+ * @return std::size_t Number of triangles.
+ */
+inline std::size_t count_triangles(const IGraph &G);
+
+/**
+ * @brief Number of triangles of each vertex of the graph.
+ *
+ * @param G Given graph.
+ * @return std::vector<std::size_t> Triangles through each vertex, indexed by vertex id.
+ * @see count_triangles
+ */
+inline std::vector<std::size_t> vertex_triangles(const IGraph &G);
+
+/**
+ * @brief Local clustering coefficient of each vertex of the graph.
+ *
+ * Fraction of the pairs of neighbors of each vertex that are adjacent, on
+ * the underlying undirected simple graph, zero for vertices of degree lower
+ * than two and for missing vertex ids.
+ *
+ * @param G Given graph.
+ * @return std::vector<double> Local clustering coefficients, indexed by vertex id.
+ */
+inline std::vector<double> local_clustering(const IGraph &G);
+
+/**
+ * @brief Global clustering coefficient, i.e. transitivity, of the graph.
+ *
+ * Three times the number of triangles over the number of connected triples,
+ * on the underlying undirected simple graph, zero if there are no triples.
+ *
+ * @param G Given graph.
+ * @return double Global clustering coefficient.
+ */
+inline double global_clustering(const IGraph &G);
+
+}  // namespace telegraph
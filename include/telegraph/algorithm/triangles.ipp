@@ -0,0 +1,283 @@
+#pragma once
+
+#include "triangles.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Rows of bits per parallel chunk.
+static constexpr std::size_t TRIANGLE_ROWS_GRAIN = 16;
+//! Neighbor lists per parallel chunk.
+static constexpr std::size_t TRIANGLE_LISTS_GRAIN = 256;
+
+/**
+ * @brief Bit rows of the underlying undirected simple graph of a dense graph.
+ *
+ * @param G Given dense graph.
+ * @return BitMatrix Symmetric adjacency matrix without diagonal.
+ */
+inline BitMatrix symmetric_rows(const DenseGraph &G) {
+    const BitMatrix &A = G.adjacency();
+    const std::size_t n = A.rows();
+    BitMatrix out(A);
+    // Mirror each edge, the scatter is linear in the number of edges.
+    for (std::size_t i = 0; i < n; i++) {
+        for (std::size_t j = A.next(i, 0); j < n; j = A.next(i, j + 1)) out.set(j, i);
+    }
+    for (std::size_t i = 0; i < n; i++) out.reset(i, i);
+    return out;
+}
+
+/**
+ * @brief Sorted neighbor lists of the underlying undirected simple graph.
+ *
+ * @param G Given graph.
+ * @return CSR Symmetric snapshot without self loops, each row sorted.
+ */
+inline CSR symmetric_lists(const IGraph &G) {
+    const CSR C(G), T = C.transpose();
+    const std::size_t n = C.rows();
+    // Merge children and parents in a scratch buffer, each row at its upper bound offset.
+    std::vector<VID> buffer(2 * C.nonzeros());
+    CSR out;
+    out.offsets.assign(n + 1, 0);
+    parallel_for(n, CSR_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (VID X = b; X < e; X++) {
+            VID *first = buffer.data() + C.offsets[X] + T.offsets[X];
+            VID *last = std::copy(C.targets.begin() + C.offsets[X], C.targets.begin() + C.offsets[X + 1], first);
+            last = std::copy(T.targets.begin() + T.offsets[X], T.targets.begin() + T.offsets[X + 1], last);
+            std::sort(first, last);
+            last = std::unique(first, last);
+            last = std::remove(first, last, X);
+            out.offsets[X + 1] = last - first;
+        }
+    });
+    for (std::size_t i = 0; i < n; i++) out.offsets[i + 1] += out.offsets[i];
+    // Compact the rows.
+    out.targets.resize(out.offsets[n]);
+    parallel_for(n, CSR_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (VID X = b; X < e; X++) {
+            const VID *first = buffer.data() + C.offsets[X] + T.offsets[X];
+            std::copy(first, first + (out.offsets[X + 1] - out.offsets[X]), out.targets.begin() + out.offsets[X]);
+        }
+    });
+    return out;
+}
+
+/**
+ * @brief Orient the edges of sorted neighbor lists from lower to higher degree.
+ *
+ * Ties are broken by vertex id, hence each undirected edge is kept once, and
+ * each vertex keeps at most about the square root of the edges as neighbors.
+ *
+ * @param U Given symmetric snapshot, each row sorted.
+ * @return CSR Oriented snapshot, each row sorted.
+ */
+inline CSR orient(const CSR &U) {
+    const std::size_t n = U.rows();
+    auto degree = [&](const VID &X) { return U.offsets[X + 1] - U.offsets[X]; };
+    auto before = [&](const VID &X, const VID &Y) {
+        return degree(X) < degree(Y) || (degree(X) == degree(Y) && X < Y);
+    };
+    CSR out;
+    out.offsets.assign(n + 1, 0);
+    parallel_for(n, CSR_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (VID X = b; X < e; X++) {
+            for (std::size_t j = U.offsets[X]; j < U.offsets[X + 1]; j++) out.offsets[X + 1] += before(X, U.targets[j]);
+        }
+    });
+    for (std::size_t i = 0; i < n; i++) out.offsets[i + 1] += out.offsets[i];
+    out.targets.resize(out.offsets[n]);
+    parallel_for(n, CSR_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (VID X = b; X < e; X++) {
+            std::size_t k = out.offsets[X];
+            for (std::size_t j = U.offsets[X]; j < U.offsets[X + 1]; j++) {
+                if (before(X, U.targets[j])) out.targets[k++] = U.targets[j];
+            }
+        }
+    });
+    return out;
+}
+
+/**
+ * @brief Size of the intersection of two sorted vertex id sequences.
+ *
+ * The merge is branch-free, both cursors advance by the result of the
+ * comparisons, hence it does not suffer from mispredictions.
+ *
+ * @param a Given first sequence begin.
+ * @param ae Given first sequence end.
+ * @param b Given second sequence begin.
+ * @param be Given second sequence end.
+ * @return std::size_t Number of common vertex ids.
+ */
+inline std::size_t intersection(const VID *a, const VID *ae, const VID *b, const VID *be) {
+    std::size_t out = 0;
+    while (a != ae && b != be) {
+        const VID x = *a, y = *b;
+        out += x == y;
+        a += x <= y;
+        b += y <= x;
+    }
+    return out;
+}
+
+//! Undirected degree of each vertex.
+inline std::vector<std::size_t> degrees(const BitMatrix &U) {
+    std::vector<std::size_t> out(U.rows());
+    parallel_for(U.rows(), TRIANGLE_ROWS_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (std::size_t i = b; i < e; i++) out[i] = U.count(i);
+    });
+    return out;
+}
+
+//! Undirected degree of each vertex.
+inline std::vector<std::size_t> degrees(const CSR &U) {
+    std::vector<std::size_t> out(U.rows());
+    for (VID X = 0; X < U.rows(); X++) out[X] = U.offsets[X + 1] - U.offsets[X];
+    return out;
+}
+
+//! Number of triangles, each counted at its lowest vertex id.
+inline std::size_t triangles(const BitMatrix &U) {
+    const std::size_t n = U.rows(), w = (n + BitMatrix::WORD_BITS - 1) / BitMatrix::WORD_BITS;
+    std::atomic<std::size_t> out(0);
+    parallel_for(n, TRIANGLE_ROWS_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        std::size_t count = 0;
+        for (std::size_t i = b; i < e; i++) {
+            const BitMatrix::Word *r = U.row(i);
+            for (std::size_t j = U.next(i, i + 1); j < n; j = U.next(i, j + 1)) {
+                // Count the common neighbors above j, masking the first word.
+                const BitMatrix::Word *q = U.row(j);
+                const std::size_t k = (j + 1) / BitMatrix::WORD_BITS;
+                if (k >= w) continue;
+                const BitMatrix::Word mask = ~BitMatrix::Word(0) << ((j + 1) % BitMatrix::WORD_BITS);
+                count += __builtin_popcountll(r[k] & q[k] & mask);
+                count += BitMatrix::popcount(r + k + 1, q + k + 1, w - k - 1);
+            }
+        }
+        out.fetch_add(count, std::memory_order_relaxed);
+    });
+    return out.load();
+}
+
+//! Number of triangles, each counted at its lowest vertex in degree order.
+inline std::size_t triangles(const CSR &U) {
+    const CSR O = orient(U);
+    const VID *T = O.targets.data();
+    std::atomic<std::size_t> out(0);
+    parallel_for(O.rows(), TRIANGLE_LISTS_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        std::size_t count = 0;
+        for (VID X = b; X < e; X++) {
+            for (std::size_t j = O.offsets[X]; j < O.offsets[X + 1]; j++) {
+                const VID &Y = T[j];
+                count += intersection(T + O.offsets[X], T + O.offsets[X + 1], T + O.offsets[Y], T + O.offsets[Y + 1]);
+            }
+        }
+        out.fetch_add(count, std::memory_order_relaxed);
+    });
+    return out.load();
+}
+
+//! Number of triangles through each vertex.
+inline std::vector<std::size_t> vertex_triangles(const BitMatrix &U) {
+    const std::size_t n = U.rows(), w = (n + BitMatrix::WORD_BITS - 1) / BitMatrix::WORD_BITS;
+    std::vector<std::size_t> out(n);
+    // Each triangle through a vertex is the common neighbor of two of its neighbors.
+    parallel_for(n, TRIANGLE_ROWS_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (std::size_t i = b; i < e; i++) {
+            std::size_t count = 0;
+            for (std::size_t j = U.next(i, 0); j < n; j = U.next(i, j + 1)) {
+                count += BitMatrix::popcount(U.row(i), U.row(j), w);
+            }
+            out[i] = count / 2;
+        }
+    });
+    return out;
+}
+
+//! Number of triangles through each vertex.
+inline std::vector<std::size_t> vertex_triangles(const CSR &U) {
+    const CSR O = orient(U);
+    const VID *T = O.targets.data();
+    std::vector<std::atomic<std::size_t>> count(O.rows());
+    for (auto &c : count) c.store(0, std::memory_order_relaxed);
+    // Enumerate each triangle once, then credit its three vertices.
+    parallel_for(O.rows(), TRIANGLE_LISTS_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (VID X = b; X < e; X++) {
+            for (std::size_t j = O.offsets[X]; j < O.offsets[X + 1]; j++) {
+                const VID &Y = T[j];
+                const VID *a = T + O.offsets[X], *ae = T + O.offsets[X + 1];
+                const VID *c = T + O.offsets[Y], *ce = T + O.offsets[Y + 1];
+                while (a != ae && c != ce) {
+                    if (*a < *c) {
+                        a++;
+                    } else if (*c < *a) {
+                        c++;
+                    } else {
+                        count[X].fetch_add(1, std::memory_order_relaxed);
+                        count[Y].fetch_add(1, std::memory_order_relaxed);
+                        count[*a].fetch_add(1, std::memory_order_relaxed);
+                        a++;
+                        c++;
+                    }
+                }
+            }
+        }
+    });
+    std::vector<std::size_t> out(count.size());
+    for (std::size_t i = 0; i < out.size(); i++) out[i] = count[i].load(std::memory_order_relaxed);
+    return out;
+}
+
+/**
+ * @brief Apply a function to the underlying undirected simple graph.
+ *
+ * @tparam F Function typename, callable with either a BitMatrix or a CSR.
+ * @param G Given graph.
+ * @param f Given function.
+ * @return auto Result of the function.
+ */
+template <typename F>
+inline auto on_symmetric(const IGraph &G, const F &f) {
+    // Run the bitset kernels on dense graphs.
+    if (const auto *D = dynamic_cast<const DenseGraph *>(&G)) return f(symmetric_rows(*D));
+    return f(symmetric_lists(G));
+}
+
+}  // namespace detail
+
+inline std::size_t count_triangles(const IGraph &G) {
+    return detail::on_symmetric(G, [](const auto &U) { return detail::triangles(U); });
+}
+
+inline std::vector<std::size_t> vertex_triangles(const IGraph &G) {
+    return detail::on_symmetric(G, [](const auto &U) { return detail::vertex_triangles(U); });
+}
+
+inline std::vector<double> local_clustering(const IGraph &G) {
+    return detail::on_symmetric(G, [](const auto &U) {
+        const std::vector<std::size_t> t = detail::vertex_triangles(U), d = detail::degrees(U);
+        std::vector<double> out(t.size(), 0);
+        for (std::size_t i = 0; i < t.size(); i++) {
+            if (d[i] > 1) out[i] = 2.0 * t[i] / (static_cast<double>(d[i]) * (d[i] - 1));
+        }
+        return out;
+    });
+}
+
+inline double global_clustering(const IGraph &G) {
+    return detail::on_symmetric(G, [](const auto &U) {
+        const std::vector<std::size_t> d = detail::degrees(U);
+        // Count the connected triples, i.e. the pairs of neighbors of each vertex.
+        double triples = 0;
+        for (const std::size_t &k : d) {
+            if (k > 1) triples += k * (k - 1) / 2.0;
+        }
+        if (triples == 0) return 0.0;
+        return 3.0 * detail::triangles(U) / triples;
+    });
+}
+
+}  // namespace telegraph
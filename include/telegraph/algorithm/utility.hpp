@@ -0,0 +1,65 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../interface/interface_graph.ipp"
+
+namespace telegraph {
+
+//! Bitmap storage word type.
+using Word = std::uint64_t;
+
+//! Number of bits per bitmap word.
+static constexpr std::size_t WORD_BITS = 64;
+
+/**
+ * @brief Number of worker threads used by the parallel algorithms.
+ *
+ * Defaults to the hardware concurrency, at least one.
+ *
+ * @return std::size_t Number of worker threads.
+ */
+inline std::size_t concurrency();
+
+/**
+ * @brief Set the number of worker threads used by the parallel algorithms.
+ *
+ * @param k Given number of worker threads, zero resets to the hardware concurrency.
+ */
+inline void set_concurrency(std::size_t k);
+
+/**
+ * @brief Apply a function to the chunks of an index range in parallel.
+ *
+ * The range [0, n) is split into chunks of *grain* indices, which are claimed
+ * dynamically by the worker threads, the calling thread included. Workers are
+ * kept parked between calls, so a call costs a few microseconds to wake them
+ * up, instead of creating threads. Ranges not longer than a single chunk are
+ * processed by the calling thread alone, as are nested calls, so that small
+ * steps do not pay for the wake-up.
+ *
+ * @tparam F Function typename, callable as f(begin, end, t).
+ * @param n Given number of indices.
+ * @param grain Given number of indices per chunk.
+ * @param f Given function, *t* is the worker index in [0, concurrency()).
+ */
+template <typename F>
+inline void parallel_for(std::size_t n, std::size_t grain, const F &f);
+
+/**
+ * @brief Upper bound of the vertex ids of a graph.
+ *
+ * @param G Given graph.
+ * @return std::size_t Highest vertex id plus one, zero if none.
+ */
+inline std::size_t vertex_bound(const IGraph &G);
+
+}  // namespace telegraph
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "utility.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Number of worker threads set by the user, zero if unset.
+inline std::atomic<std::size_t> &workers() {
+    static std::atomic<std::size_t> k(0);
+    return k;
+}
+
+/**
+ * @brief Persistent worker threads shared by the parallel loops.
+ *
+ * Threads are started on first use and parked on a condition variable between
+ * jobs, so that a parallel loop costs a wake-up instead of a thread creation.
+ * A single job runs at a time, the caller taking part as worker zero.
+ */
+class WorkerPool {
+   protected:
+    //! Guards the job state.
+    std::mutex m;
+    //! Signals a new job, or the shutdown.
+    std::condition_variable wake;
+    //! Signals the end of a job.
+    std::condition_variable done;
+    //! Parked threads, the i-th one being worker i + 1.
+    std::vector<std::thread> threads;
+    //! Set while a job is submitted.
+    std::atomic<bool> busy;
+    //! Current job.
+    const std::function<void(std::size_t)> *job;
+    //! Number of workers of the current job.
+    std::size_t k;
+    //! Number of workers still running the current job.
+    std::size_t pending;
+    //! Incremented for each job.
+    std::size_t generation;
+    //! Set on shutdown.
+    bool stop;
+
+    //! Loop of the t-th worker.
+    inline void loop(std::size_t t) {
+        std::size_t seen = 0;
+        std::unique_lock<std::mutex> lock(m);
+        while (true) {
+            wake.wait(lock, [&]() { return stop || generation != seen; });
+            if (stop) return;
+            seen = generation;
+            if (t >= k) continue;
+            lock.unlock();
+            (*job)(t);
+            lock.lock();
+            if (--pending == 0) done.notify_one();
+        }
+    }
+
+   public:
+    inline WorkerPool() : busy(false), job(nullptr), k(0), pending(0), generation(0), stop(false) {}
+
+    inline ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(m);
+            stop = true;
+        }
+        wake.notify_all();
+        for (auto &thread : threads) thread.join();
+    }
+
+    //! Process-wide pool.
+    static inline WorkerPool &instance() {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Run a job on *k* workers, the calling thread included.
+     *
+     * @param k Given number of workers.
+     * @param f Given job, called once with each worker index in [0, k).
+     * @return true If the job has been run,
+     * @return false If the pool is running another job, e.g. from a nested loop.
+     */
+    inline bool run(std::size_t k, const std::function<void(std::size_t)> &f) {
+        bool expected = false;
+        if (!busy.compare_exchange_strong(expected, true)) return false;
+        {
+            std::lock_guard<std::mutex> lock(m);
+            while (threads.size() + 1 < k) threads.emplace_back(&WorkerPool::loop, this, threads.size() + 1);
+            job = &f;
+            this->k = k;
+            pending = k - 1;
+            generation++;
+        }
+        wake.notify_all();
+        // Wait for the other workers even if the calling one throws.
+        std::exception_ptr error;
+        try {
+            f(0);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        {
+            std::unique_lock<std::mutex> lock(m);
+            done.wait(lock, [&]() { return pending == 0; });
+            job = nullptr;
+        }
+        busy.store(false);
+        if (error) std::rethrow_exception(error);
+        return true;
+    }
+};
+
+}  // namespace detail
+
+inline std::size_t concurrency() {
+    std::size_t k = detail::workers().load(std::memory_order_relaxed);
+    if (k == 0) k = std::thread::hardware_concurrency();
+    return std::max<std::size_t>(k, 1);
+}
+
+inline void set_concurrency(std::size_t k) { detail::workers().store(k, std::memory_order_relaxed); }
+
+template <typename F>
+inline void parallel_for(std::size_t n, std::size_t grain, const F &f) {
+    grain = std::max<std::size_t>(grain, 1);
+    // Run small ranges on the calling thread.
+    const std::size_t chunks = (n + grain - 1) / grain;
+    const std::size_t k = std::min(concurrency(), chunks);
+    if (k <= 1) {
+        if (n > 0) f(std::size_t(0), n, std::size_t(0));
+        return;
+    }
+    // Claim chunks dynamically to balance skewed workloads.
+    std::atomic<std::size_t> next(0);
+    auto work = [&](std::size_t t) {
+        for (std::size_t c = next.fetch_add(1); c < chunks; c = next.fetch_add(1)) {
+            f(c * grain, std::min(n, (c + 1) * grain), t);
+        }
+    };
+    // Run on the calling thread alone if the pool is already in use.
+    if (!detail::WorkerPool::instance().run(k, work)) f(std::size_t(0), n, std::size_t(0));
+}
+
+inline std::size_t vertex_bound(const IGraph &G) {
+    std::size_t n = 0;
+    for (const VID &X : G.V()) n = std::max<std::size_t>(n, X + 1);
+    return n;
+}
+
+}  // namespace telegraph
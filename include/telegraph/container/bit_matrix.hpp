@@ -0,0 +1,259 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include "../algorithm/utility.ipp"
+#include "../interface/interface_graph.ipp"
+
+/**
+ * @brief Bit-packed square boolean matrix.
+ *
+ * Each row is stored as a sequence of 64-bit words, one bit per cell,
+ * and the row stride is padded to a multiple of 64 bytes so that every
+ * row starts on a cache line boundary. Padding bits are always zero,
+ * which allows whole-buffer kernels (e.g. popcount) without masking.
+ *
+ * The logical size is decoupled from the allocated capacity: growing
+ * within the capacity touches no memory, while growing past it at least
+ * doubles the capacity, so that repeated growth is amortized.
+ */
+class BitMatrix {
+   public:
+    //! Storage word type.
+    using Word = std::uint64_t;
+    //! Number of bits per storage word.
+    static constexpr std::size_t WORD_BITS = 64;
+    //! Row alignment in bytes.
+    static constexpr std::size_t ALIGNMENT = 64;
+    //! Number of words per aligned line.
+    static constexpr std::size_t LINE_WORDS = ALIGNMENT / sizeof(Word);
+
+   protected:
+    //! Deleter for aligned storage.
+    struct Deleter {
+        void operator()(Word *p) const { std::free(p); }
+    };
+
+    //! Number of rows and columns.
+    std::size_t n;
+    //! Number of allocated rows and columns.
+    std::size_t c;
+    //! Number of words per row.
+    std::size_t s;
+    //! Aligned storage buffer.
+    std::unique_ptr<Word[], Deleter> data;
+
+    /**
+     * @brief Compute the number of words per row given the number of columns.
+     *
+     * @param n Given number of columns.
+     * @return std::size_t Number of words per row, aligned to ALIGNMENT.
+     */
+    static inline std::size_t stride_of(std::size_t n);
+
+    /**
+     * @brief Allocate a zero-initialized aligned buffer.
+     *
+     * @param words Given number of words.
+     * @return Word* Pointer to the aligned buffer.
+     */
+    static inline Word *allocate(std::size_t words);
+
+   public:
+    //! Default constructor for an empty Bit Matrix object.
+    BitMatrix();
+
+    //! Copy constructor for a new Bit Matrix object.
+    BitMatrix(const BitMatrix &other);
+
+    //! Move constructor for a new Bit Matrix object.
+    BitMatrix(BitMatrix &&other) noexcept;
+
+    //! Copy assignment operator.
+    BitMatrix &operator=(const BitMatrix &other);
+
+    //! Move assignment operator.
+    BitMatrix &operator=(BitMatrix &&other) noexcept;
+
+    /**
+     * @brief Construct a new zero Bit Matrix object of given size.
+     *
+     * @param n Given number of rows and columns.
+     */
+    explicit BitMatrix(std::size_t n);
+
+    /**
+     * @brief Construct a new Bit Matrix object from a dense adjacency matrix.
+     *
+     * @param other Given dense adjacency matrix, non-zero cells are set.
+     */
+    explicit BitMatrix(const AdjacencyMatrix &other);
+
+    /**
+     * @brief Construct a new Bit Matrix object from a sparse adjacency matrix.
+     *
+     * @param other Given sparse adjacency matrix, non-zero cells are set.
+     */
+    explicit BitMatrix(const SparseAdjacencyMatrix &other);
+
+    /**
+     * @brief The dense adjacency matrix representation of the bit matrix.
+     *
+     * @return AdjacencyMatrix Dense adjacency matrix.
+     */
+    inline operator AdjacencyMatrix() const;
+
+    /**
+     * @brief The sparse adjacency matrix representation of the bit matrix.
+     *
+     * @return SparseAdjacencyMatrix Sparse adjacency matrix.
+     */
+    inline operator SparseAdjacencyMatrix() const;
+
+    //! Number of rows and columns.
+    inline std::size_t rows() const;
+
+    //! Number of allocated rows and columns.
+    inline std::size_t capacity() const;
+
+    //! Number of words per row.
+    inline std::size_t stride() const;
+
+    /**
+     * @brief Pointer to the first word of a given row.
+     *
+     * @param i Given row index.
+     * @return const Word* Row pointer.
+     */
+    inline const Word *row(std::size_t i) const;
+
+    /**
+     * @brief Pointer to the first word of a given row.
+     *
+     * @param i Given row index.
+     * @return Word* Row pointer.
+     */
+    inline Word *row(std::size_t i);
+
+    /**
+     * @brief Get the value of a given cell.
+     *
+     * @param i Given row index.
+     * @param j Given column index.
+     * @return true If the cell is set,
+     * @return false Otherwise.
+     */
+    inline bool test(std::size_t i, std::size_t j) const;
+
+    /**
+     * @brief Set a given cell.
+     *
+     * @param i Given row index.
+     * @param j Given column index.
+     */
+    inline void set(std::size_t i, std::size_t j);
+
+    /**
+     * @brief Reset a given cell.
+     *
+     * @param i Given row index.
+     * @param j Given column index.
+     */
+    inline void reset(std::size_t i, std::size_t j);
+
+    /**
+     * @brief Count the number of set cells.
+     *
+     * @return std::size_t Number of set cells.
+     */
+    inline std::size_t count() const;
+
+    /**
+     * @brief Count the number of set cells of a given row.
+     *
+     * @param i Given row index.
+     * @return std::size_t Number of set cells in the row.
+     */
+    inline std::size_t count(std::size_t i) const;
+
+    /**
+     * @brief Find the next set cell of a given row.
+     *
+     * Zero words are skipped without inspecting their bits.
+     *
+     * @param i Given row index.
+     * @param j Given starting column index, included.
+     * @return std::size_t Column index of the next set cell, rows() if none.
+     */
+    inline std::size_t next(std::size_t i, std::size_t j) const;
+
+    /**
+     * @brief Reserve storage for a given number of rows and columns.
+     *
+     * @param k Given number of rows and columns.
+     */
+    inline void reserve(std::size_t k);
+
+    /**
+     * @brief Resize the matrix preserving its content.
+     *
+     * Newly exposed cells are set to zero. Storage is reallocated only
+     * when the new size exceeds the capacity, which is then at least doubled.
+     *
+     * @param m Given number of rows and columns.
+     */
+    inline void resize(std::size_t m);
+
+    //! Release the capacity exceeding the current size.
+    inline void shrink_to_fit();
+
+    //! Heap bytes of the storage buffer.
+    inline std::size_t heap_size() const;
+
+    //! Heap bytes of the storage buffer exceeding the current size.
+    inline std::size_t heap_slack() const;
+
+    /**
+     * @brief Boolean product of two matrices, i.e. the composition of their relations.
+     *
+     * Cell (i, j) of the product is set if there is a *k* such that cell (i, k) is set
+     * in this matrix and cell (k, j) in the other one. Each row of the product is the OR
+     * of the rows of the other matrix selected by the row of this one, rows are computed
+     * in parallel. Matrices of different size are padded with zeros.
+     *
+     * @param other Given right-hand matrix.
+     * @return BitMatrix Boolean product.
+     */
+    inline BitMatrix operator*(const BitMatrix &other) const;
+
+    /**
+     * @brief Count the set bits of a contiguous word sequence.
+     *
+     * @param words Given word sequence.
+     * @param k Given number of words.
+     * @return std::size_t Number of set bits.
+     */
+    static inline std::size_t popcount(const Word *words, std::size_t k);
+
+    /**
+     * @brief Count the set bits of the conjunction of two contiguous word sequences.
+     *
+     * @param a Given first word sequence.
+     * @param b Given second word sequence.
+     * @param k Given number of words.
+     * @return std::size_t Number of bits set in both sequences.
+     */
+    static inline std::size_t popcount(const Word *a, const Word *b, std::size_t k);
+
+    /**
+     * @brief OR a contiguous word sequence into another one.
+     *
+     * @param out Given destination word sequence.
+     * @param words Given source word sequence.
+     * @param k Given number of words.
+     */
+    static inline void disjunction(Word *out, const Word *words, std::size_t k);
+};
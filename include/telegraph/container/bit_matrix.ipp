@@ -0,0 +1,210 @@
+#pragma once
+
+#include "bit_matrix.hpp"
+
+inline std::size_t BitMatrix::stride_of(std::size_t n) {
+    // Round the number of columns up to whole words, then whole lines.
+    std::size_t words = (n + WORD_BITS - 1) / WORD_BITS;
+    return (words + LINE_WORDS - 1) / LINE_WORDS * LINE_WORDS;
+}
+
+inline BitMatrix::Word *BitMatrix::allocate(std::size_t words) {
+    // Avoid allocating empty buffers.
+    if (words == 0) return nullptr;
+    // The size is always a multiple of the alignment since rows are padded to whole lines.
+    void *p = std::aligned_alloc(ALIGNMENT, words * sizeof(Word));
+    if (p == nullptr) throw std::bad_alloc();
+    // Initialize the allocated memory to zero.
+    std::memset(p, 0, words * sizeof(Word));
+    return static_cast<Word *>(p);
+}
+
+BitMatrix::BitMatrix() : n(0), c(0), s(0) {}
+
+BitMatrix::BitMatrix(const BitMatrix &other) : n(other.n), c(other.c), s(other.s), data(allocate(other.c * other.s)) {
+    // Copy the logical rows only, the remaining ones are zero.
+    if (n * s > 0) std::memcpy(data.get(), other.data.get(), n * s * sizeof(Word));
+}
+
+BitMatrix::BitMatrix(BitMatrix &&other) noexcept : n(other.n), c(other.c), s(other.s), data(std::move(other.data)) {
+    other.n = 0;
+    other.c = 0;
+    other.s = 0;
+}
+
+BitMatrix &BitMatrix::operator=(const BitMatrix &other) {
+    if (this != &other) *this = BitMatrix(other);
+    return *this;
+}
+
+BitMatrix &BitMatrix::operator=(BitMatrix &&other) noexcept {
+    std::swap(n, other.n);
+    std::swap(c, other.c);
+    std::swap(s, other.s);
+    std::swap(data, other.data);
+    return *this;
+}
+
+BitMatrix::BitMatrix(std::size_t n) : n(n), c(n), s(stride_of(n)), data(allocate(n * stride_of(n))) {}
+
+BitMatrix::BitMatrix(const AdjacencyMatrix &other) : BitMatrix(other.rows()) {
+    if (other.rows() != other.cols()) throw std::invalid_argument("AdjacencyMatrix must be squared.");
+    // Iterate over rows and columns as AdjacencyMatrix is RowMajor.
+    for (std::size_t i = 0; i < n; i++) {
+        for (std::size_t j = 0; j < n; j++) {
+            if (other(i, j) != 0) set(i, j);
+        }
+    }
+}
+
+BitMatrix::BitMatrix(const SparseAdjacencyMatrix &other) : BitMatrix(other.rows()) {
+    if (other.rows() != other.cols()) throw std::invalid_argument("AdjacencyMatrix must be squared.");
+    // Iterate over the non-zero cells only.
+    for (Eigen::Index k = 0; k < other.outerSize(); k++) {
+        for (SparseAdjacencyMatrix::InnerIterator it(other, k); it; ++it) {
+            if (it.value() != 0) set(it.row(), it.col());
+        }
+    }
+}
+
+inline BitMatrix::operator AdjacencyMatrix() const {
+    AdjacencyMatrix out = AdjacencyMatrix::Zero(n, n);
+    // Iterate over set cells only.
+    for (std::size_t i = 0; i < n; i++) {
+        for (std::size_t j = next(i, 0); j < n; j = next(i, j + 1)) out(i, j) = 1;
+    }
+    return out;
+}
+
+inline BitMatrix::operator SparseAdjacencyMatrix() const {
+    SparseAdjacencyMatrix out(n, n);
+    // Reserve the exact number of non-zeros per row.
+    Eigen::VectorXi nnz(n);
+    for (std::size_t i = 0; i < n; i++) nnz(i) = count(i);
+    out.reserve(nnz);
+    // Insert cells in row order, which is the storage order.
+    for (std::size_t i = 0; i < n; i++) {
+        for (std::size_t j = next(i, 0); j < n; j = next(i, j + 1)) out.insert(i, j) = 1;
+    }
+    out.makeCompressed();
+    return out;
+}
+
+inline std::size_t BitMatrix::rows() const { return n; }
+
+inline std::size_t BitMatrix::capacity() const { return c; }
+
+inline std::size_t BitMatrix::stride() const { return s; }
+
+inline const BitMatrix::Word *BitMatrix::row(std::size_t i) const { return data.get() + i * s; }
+
+inline BitMatrix::Word *BitMatrix::row(std::size_t i) { return data.get() + i * s; }
+
+inline bool BitMatrix::test(std::size_t i, std::size_t j) const {
+    return (row(i)[j / WORD_BITS] >> (j % WORD_BITS)) & 1;
+}
+
+inline void BitMatrix::set(std::size_t i, std::size_t j) { row(i)[j / WORD_BITS] |= Word(1) << (j % WORD_BITS); }
+
+inline void BitMatrix::reset(std::size_t i, std::size_t j) { row(i)[j / WORD_BITS] &= ~(Word(1) << (j % WORD_BITS)); }
+
+inline std::size_t BitMatrix::count() const {
+    // Padding bits are zero, hence the whole buffer can be counted at once.
+    return popcount(data.get(), n * s);
+}
+
+inline std::size_t BitMatrix::count(std::size_t i) const { return popcount(row(i), s); }
+
+inline std::size_t BitMatrix::next(std::size_t i, std::size_t j) const {
+    if (j >= n) return n;
+    const Word *r = row(i);
+    // Get the index of the last word holding columns.
+    const std::size_t e = (n + WORD_BITS - 1) / WORD_BITS;
+    // Mask out the columns before j in the first word.
+    std::size_t k = j / WORD_BITS;
+    Word w = r[k] & (~Word(0) << (j % WORD_BITS));
+    // Skip zero words, padding bits are zero so the result is always below n.
+    while (w == 0) {
+        if (++k == e) return n;
+        w = r[k];
+    }
+    return k * WORD_BITS + __builtin_ctzll(w);
+}
+
+inline void BitMatrix::reserve(std::size_t k) {
+    if (k <= c) return;
+    // Allocate a new zero matrix.
+    BitMatrix out(k);
+    out.n = n;
+    // Copy the logical rows, word by word.
+    std::size_t w = std::min(s, out.s);
+    for (std::size_t i = 0; i < n; i++) std::memcpy(out.row(i), row(i), w * sizeof(Word));
+    *this = std::move(out);
+}
+
+inline void BitMatrix::resize(std::size_t m) {
+    // Grow the capacity geometrically.
+    if (m > c) reserve(std::max(m, 2 * c));
+    // Clear the cells beyond the new size, to keep padding bits zero.
+    if (m < n) {
+        // Clear the rows beyond the new size.
+        std::memset(row(m), 0, (n - m) * s * sizeof(Word));
+        // Clear the columns beyond the new size.
+        std::size_t k = m / WORD_BITS;
+        Word mask = (Word(1) << (m % WORD_BITS)) - 1;
+        std::size_t e = (n + WORD_BITS - 1) / WORD_BITS;
+        for (std::size_t i = 0; i < m; i++) {
+            Word *r = row(i);
+            r[k] &= mask;
+            std::fill(r + k + 1, r + e, 0);
+        }
+    }
+    n = m;
+}
+
+inline void BitMatrix::shrink_to_fit() {
+    if (c == n) return;
+    // Allocate a new zero matrix of the exact size.
+    BitMatrix out(n);
+    // Copy the logical rows, word by word.
+    for (std::size_t i = 0; i < n; i++) std::memcpy(out.row(i), row(i), out.s * sizeof(Word));
+    *this = std::move(out);
+}
+
+inline std::size_t BitMatrix::heap_size() const { return c * s * sizeof(Word); }
+
+inline std::size_t BitMatrix::heap_slack() const { return (c * s - n * stride_of(n)) * sizeof(Word); }
+
+inline BitMatrix BitMatrix::operator*(const BitMatrix &other) const {
+    BitMatrix out(std::max(n, other.n));
+    // Cells beyond the size of the other matrix are zero, hence its shorter rows are ORed as they are.
+    const std::size_t w = std::min(out.s, other.s);
+    telegraph::parallel_for(n, 64, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (std::size_t i = b; i < e; i++) {
+            Word *r = out.row(i);
+            for (std::size_t k = next(i, 0); k < std::min(n, other.n); k = next(i, k + 1)) {
+                disjunction(r, other.row(k), w);
+            }
+        }
+    });
+    return out;
+}
+
+inline std::size_t BitMatrix::popcount(const Word *words, std::size_t k) {
+    // Plain reduction loop, vectorized by the compiler when a SIMD popcount is available.
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < k; i++) out += __builtin_popcountll(words[i]);
+    return out;
+}
+
+inline std::size_t BitMatrix::popcount(const Word *a, const Word *b, std::size_t k) {
+    // Fused AND and popcount, without materializing the conjunction.
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < k; i++) out += __builtin_popcountll(a[i] & b[i]);
+    return out;
+}
+
+inline void BitMatrix::disjunction(Word *out, const Word *words, std::size_t k) {
+    // Plain loop over aligned rows, vectorized by the compiler to the widest SIMD OR available.
+    for (std::size_t i = 0; i < k; i++) out[i] |= words[i];
+}
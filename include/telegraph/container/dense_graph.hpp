@@ -1,18 +1,53 @@
 #pragma once
 
+#include "../algorithm/components.ipp"
 #include "../interface/abstract_graph.ipp"
+#include "bit_matrix.ipp"
 
 class DenseGraph : public AbstractGraph {
    protected:
-    AdjacencyMatrix A;
+    //! Bit-packed adjacency matrix.
+    BitMatrix A;
+    //! Number of edges.
+    std::size_t m;
+    //! In-degree of each vertex.
+    std::vector<std::size_t> din;
+    //! Out-degree of each vertex.
+    std::vector<std::size_t> dout;
+
+    //! Count edges and degrees from the adjacency matrix.
+    inline void count_degrees();
+
+    /**
+     * @brief Compute the reachability matrix, with or without the trivial paths.
+     *
+     * @param reflexive Whether each vertex reaches itself or only through a cycle.
+     * @return BitMatrix Reachability matrix.
+     */
+    inline BitMatrix closure(bool reflexive) const;
 
    public:
+    // Expose the label-based overloads hidden by the overrides below.
+    using AbstractGraph::add_edge;
+    using AbstractGraph::add_vertex;
+    using AbstractGraph::del_edge;
+    using AbstractGraph::del_vertex;
+    using AbstractGraph::has_edge;
+    using AbstractGraph::has_vertex;
+
     DenseGraph();
 
     DenseGraph(const DenseGraph &other);
 
     DenseGraph &operator=(const DenseGraph &other);
 
+    /**
+     * @brief Swap the content of two graphs.
+     *
+     * @param other Given graph.
+     */
+    inline void swap(DenseGraph &other);
+
     virtual ~DenseGraph();
 
     explicit DenseGraph(std::size_t n);
@@ -69,6 +104,71 @@ class DenseGraph : public AbstractGraph {
 
     inline virtual std::size_t size() const override;
 
+    inline virtual MemoryUsage memory_usage() const override;
+
+    inline virtual void shrink_to_fit() override;
+
+    /**
+     * @brief Number of vertices the graph can hold without reallocating.
+     *
+     * @return std::size_t Allocated number of vertices.
+     */
+    inline std::size_t capacity() const;
+
+    /**
+     * @brief Reserve storage for a given number of vertices.
+     *
+     * Adding vertices up to the reserved capacity does not copy the adjacency matrix.
+     *
+     * @param n Given number of vertices.
+     */
+    inline void reserve(std::size_t n);
+
+    /**
+     * @brief The bit-packed adjacency matrix, row *i* holds the children of vertex *i*.
+     *
+     * Rows of deleted vertices are zero, the reference is invalidated by the next modification.
+     *
+     * @return const BitMatrix& Adjacency matrix.
+     */
+    inline const BitMatrix &adjacency() const;
+
+    /**
+     * @brief The reachability matrix of the graph.
+     *
+     * Cell (X, Y) is set if Y is reachable from X, X included. Vertices are
+     * collapsed into their strongly connected components, then the rows of
+     * the components are ORed in reverse topological order, one level of the
+     * condensation at a time in parallel. Rows of deleted vertices are zero.
+     *
+     * @return BitMatrix Reachability matrix.
+     */
+    inline BitMatrix reachability_matrix() const;
+
+    /**
+     * @brief The transitive closure of the graph.
+     *
+     * Edge (X, Y) is in the closure if Y is reachable from X through at least
+     * one edge. Vertex ids are preserved, labels and attributes are not copied.
+     *
+     * @return DenseGraph Transitive closure.
+     */
+    inline DenseGraph transitive_closure() const;
+
+    /**
+     * @brief The composition of two graphs, i.e. the Boolean product of their adjacency matrices.
+     *
+     * Edge (X, Z) is in the composition if there is a vertex Y such that (X, Y)
+     * is an edge of this graph and (Y, Z) an edge of the other one. The
+     * composition has as many vertex ids as the larger graph, the deleted
+     * vertices of either graph are kept as such, labels and attributes are
+     * not copied.
+     *
+     * @param other Given right-hand graph.
+     * @return DenseGraph Composition of the graphs.
+     */
+    inline DenseGraph operator*(const DenseGraph &other) const;
+
     inline virtual bool has_vertex(const VID &X) const override;
 
     inline virtual VID add_vertex() override;
@@ -77,14 +177,40 @@ class DenseGraph : public AbstractGraph {
 
     inline virtual void del_vertex(const VID &X) override;
 
+    inline virtual std::size_t in_degree(const VID &X) const override;
+
+    inline virtual std::size_t out_degree(const VID &X) const override;
+
     inline virtual bool has_edge(const EID &X) const override;
 
     inline virtual void add_edge(const EID &X) override;
 
     inline virtual void del_edge(const EID &X) override;
 
-   private:
-    inline virtual std::size_t hash() const override;
+   protected:
+    inline virtual void compact_vertices(const VID *first, const VID *last) override;
+
+    inline virtual void bulk_add_edges(const EID *first, const EID *last) override;
+
+    inline virtual void bulk_del_edges(const EID *first, const EID *last) override;
+
+    inline virtual bool next_child(const VID &X, std::size_t &i, VID &Y) const override;
 
+    /**
+     * @brief Advance a cursor over the parents of a vertex.
+     *
+     * Rows are stored as bits, hence the column of X is tested a row at a
+     * time, in O(n) time per full scan, without skipping zero words. Vertices
+     * without incoming edges are skipped at once.
+     *
+     * @param X Given vertex id.
+     * @param i Given cursor, advanced past the returned parent.
+     * @param Y Next parent vertex id.
+     * @return true If a parent has been found,
+     * @return false Otherwise.
+     */
+    inline virtual bool next_parent(const VID &X, std::size_t &i, VID &Y) const override;
+
+   private:
     virtual void print(std::ostream &out) const override;
 };
@@ -2,27 +2,112 @@
 
 #include "dense_graph.hpp"
 
-DenseGraph::DenseGraph() {}
+inline void DenseGraph::count_degrees() {
+    // Get current matrix size.
+    std::size_t n = A.rows();
+    // Reset counters.
+    m = 0;
+    din.assign(n, 0);
+    dout.assign(n, 0);
+    // Count set bits row by row, skipping zero words.
+    for (std::size_t i = 0; i < n; i++) {
+        dout[i] = A.count(i);
+        m += dout[i];
+        for (std::size_t j = A.next(i, 0); j < n; j = A.next(i, j + 1)) din[j]++;
+    }
+}
 
-DenseGraph::DenseGraph(const DenseGraph &other) : AbstractGraph(other), A(other.A) {}
+inline BitMatrix DenseGraph::closure(bool reflexive) const {
+    using telegraph::Components;
+    BitMatrix R(A.rows());
+    // Collapse the strongly connected components, numbered in reverse topological order.
+    const Components C = telegraph::strongly_connected_components(*this);
+    const std::vector<std::size_t> &c = C.component;
+    // Group the vertices by component, the first one is the representative.
+    std::vector<std::size_t> first(C.count + 1, 0);
+    for (VID i = 0; i < c.size(); i++) {
+        if (c[i] != Components::NONE) first[c[i] + 1]++;
+    }
+    for (std::size_t k = 0; k < C.count; k++) first[k + 1] += first[k];
+    std::vector<VID> members(first[C.count]);
+    std::vector<std::size_t> next(first.begin(), first.end() - 1);
+    for (VID i = 0; i < c.size(); i++) {
+        if (c[i] != Components::NONE) members[next[c[i]]++] = i;
+    }
+    // Level of each component in the condensation, children come first.
+    std::vector<std::size_t> level(C.count, 0), depth(1, 0);
+    for (std::size_t k = 0; k < C.count; k++) {
+        for (std::size_t i = first[k]; i < first[k + 1]; i++) {
+            const VID &X = members[i];
+            for (VID Y = A.next(X, 0); Y < A.rows(); Y = A.next(X, Y + 1)) {
+                if (c[Y] != k) level[k] = std::max(level[k], level[c[Y]] + 1);
+            }
+        }
+        if (level[k] + 1 >= depth.size()) depth.resize(level[k] + 2, 0);
+        depth[level[k] + 1]++;
+    }
+    // Group the components by level.
+    for (std::size_t l = 1; l < depth.size(); l++) depth[l] += depth[l - 1];
+    std::vector<std::size_t> order(C.count);
+    next.assign(depth.begin(), depth.end() - 1);
+    for (std::size_t k = 0; k < C.count; k++) order[next[level[k]]++] = k;
+    // Components of the same level do not reach each other, hence they are processed in parallel.
+    const std::size_t s = R.stride();
+    for (std::size_t l = 0; l + 1 < depth.size(); l++) {
+        telegraph::parallel_for(depth[l + 1] - depth[l], 16, [&](std::size_t b, std::size_t e, std::size_t) {
+            for (std::size_t j = depth[l] + b; j < depth[l] + e; j++) {
+                const std::size_t k = order[j];
+                BitMatrix::Word *r = R.row(members[first[k]]);
+                // A component reaches its own vertices.
+                for (std::size_t i = first[k]; i < first[k + 1]; i++) R.set(members[first[k]], members[i]);
+                // OR the rows of the children components, skipping those already reached.
+                for (std::size_t i = first[k]; i < first[k + 1]; i++) {
+                    const VID &X = members[i];
+                    for (VID Y = A.next(X, 0); Y < A.rows(); Y = A.next(X, Y + 1)) {
+                        const VID &Z = members[first[c[Y]]];
+                        if (c[Y] == k || R.test(members[first[k]], Z)) continue;
+                        BitMatrix::disjunction(r, R.row(Z), s);
+                    }
+                }
+                // Copy the row to the other vertices of the component.
+                for (std::size_t i = first[k] + 1; i < first[k + 1]; i++) {
+                    std::memcpy(R.row(members[i]), r, s * sizeof(BitMatrix::Word));
+                }
+            }
+        });
+    }
+    // Acyclic singleton components do not reach themselves through an edge.
+    if (!reflexive) {
+        for (std::size_t k = 0; k < C.count; k++) {
+            const VID &X = members[first[k]];
+            if (first[k + 1] - first[k] == 1 && !A.test(X, X)) R.reset(X, X);
+        }
+    }
+    return R;
+}
+
+DenseGraph::DenseGraph() : m(0) {}
+
+DenseGraph::DenseGraph(const DenseGraph &other)
+    : AbstractGraph(other), A(other.A), m(other.m), din(other.din), dout(other.dout) {}
 
 DenseGraph &DenseGraph::operator=(const DenseGraph &other) {
     DenseGraph tmp(other);
-    if (this != &other) {
-        std::swap(glb, tmp.glb);
-        std::swap(vlbs, tmp.vlbs);
-        std::swap(elbs, tmp.elbs);
-        std::swap(gattrs, tmp.gattrs);
-        std::swap(vattrs, tmp.vattrs);
-        std::swap(eattrs, tmp.eattrs);
-        std::swap(A, tmp.A);
-    }
+    swap(tmp);
     return *this;
 }
 
+inline void DenseGraph::swap(DenseGraph &other) {
+    AbstractGraph::swap(other);
+    std::swap(A, other.A);
+    std::swap(m, other.m);
+    std::swap(din, other.din);
+    std::swap(dout, other.dout);
+}
+
 DenseGraph::~DenseGraph() {}
 
-DenseGraph::DenseGraph(std::size_t n) { A = AdjacencyMatrix::Zero(n, n); }
+DenseGraph::DenseGraph(std::size_t n) : A(n), m(0), din(n, 0), dout(n, 0) {}
 
 template <typename I, require_iter_value_type(I, VID)>
 DenseGraph::DenseGraph(const I &begin, const I &end) {
@@ -30,33 +115,28 @@ DenseGraph::DenseGraph(const I &begin, const I &end) {
     // it is sufficient to count the number of VIDs between [begin, end).
     VID n = std::distance(begin, end);
     // Allocate a squared zero matrix.
-    A = AdjacencyMatrix::Zero(n, n);
+    A = BitMatrix(n);
+    // Initialize counters.
+    count_degrees();
 }
 
 template <typename I, require_iter_value_type(I, EID)>
 DenseGraph::DenseGraph(const I &begin, const I &end) {
+    // Collect the EIDs, since the sequence is assumed to be *not* locally stored.
+    std::vector<EID> E(begin, end);
     // Each VID in V is assumed to be (1) *unique* and (2) *between 0 and n-1*,
-    // given that the sequence is assumed to be *not* locally stored, it is
-    // necessary to *incrementally* resize the matrix when needed.
-    for (auto i = begin; i != end; i++) {
-        // Get the current matrix size.
-        VID n = order();
-        // Get the highest VID for the current EID, plus one to align the size.
-        VID v = (i->first > i->second ? i->first : i->second) + 1;
-        // Check if the VID exceeds the matrix size.
-        if (v > n) {
-            // Resize the matrix.
-            A.conservativeResize(v, v);
-            // Initialize the allocated memory to zero.
-            A(Eigen::all, Eigen::seq(n, Eigen::last)) *= 0;
-            A(Eigen::seq(n, Eigen::last), Eigen::all) *= 0;
-        }
-        // Set the edge.
-        A(i->first, i->second) = 1;
-    }
+    // hence it is sufficient to find the highest VID to size the matrix once.
+    VID n = 0;
+    for (const auto &e : E) n = std::max({n, e.first + 1, e.second + 1});
+    // Allocate a squared zero matrix.
+    A = BitMatrix(n);
+    // Initialize counters.
+    count_degrees();
+    // Set the edges in bulk.
+    add_edges(E.begin(), E.end());
 }
 
-DenseGraph::DenseGraph(const AdjacencyList &other) {
+DenseGraph::DenseGraph(const AdjacencyList &other) : m(0) {
     // Given that the adjacency list *is* locally stored, it is possible to
     // check whether each VID in V is (1) *unique* and (2) *between 0 and n-1* or not.
 
@@ -68,69 +148,126 @@ DenseGraph::DenseGraph(const AdjacencyList &other) {
         // we still need to check if each VID is (2) *between 0 and n-1* or not.
         if (n != other.size()) throw std::invalid_argument("AdjacencyList must contain VIDs *between 0 and size-1*.");
         // Allocate a squared zero matrix.
-        A = AdjacencyMatrix::Zero(n, n);
+        A = BitMatrix(n);
         // Fill the matrix.
         for (const auto &[v, adj] : other) {
             for (const auto &u : adj) {
                 // Check EID if is inconsistent with given VIDs.
                 if (other.find(u) == other.end()) throw std::out_of_range("AdjacencyList ill formed.");
                 // Set the edge.
-                A(v, u) = 1;
+                A.set(v, u);
             }
         }
     }
+    // Initialize counters.
+    count_degrees();
 }
 
-DenseGraph::DenseGraph(const AdjacencyMatrix &other) : A(other) {
-    if (other.rows() != other.cols()) throw std::invalid_argument("AdjacencyMatrix must be squared.");
-}
+DenseGraph::DenseGraph(const AdjacencyMatrix &other) : A(other) { count_degrees(); }
 
-DenseGraph::DenseGraph(const SparseAdjacencyMatrix &other) : A(other) {
-    if (other.rows() != other.cols()) throw std::invalid_argument("AdjacencyMatrix must be squared.");
-}
+DenseGraph::DenseGraph(const SparseAdjacencyMatrix &other) : A(other) { count_degrees(); }
 
 inline DenseGraph::operator AdjacencyList() const {
+    TELEGRAPH_PROBE(TO_ADJACENCY_LIST);
     // Set out parameter.
     AdjacencyList out;
     // Get current matrix size.
-    std::size_t n = order();
-    // Iterate over rows and columns as AdjacencyMatrix is RowMajor.
+    std::size_t n = A.rows();
+    // Iterate over rows and set columns, skipping zero words.
     for (std::size_t i = 0; i < n; i++) {
-        for (std::size_t j = 0; j < n; j++) {
-            if (A(i, j) != 0) out[i].insert(j);
-        }
+        for (std::size_t j = A.next(i, 0); j < n; j = A.next(i, j + 1)) out[i].insert(out[i].end(), j);
     }
     return out;
 }
 
-inline DenseGraph::operator AdjacencyMatrix() const { return A; }
+inline DenseGraph::operator AdjacencyMatrix() const {
+    TELEGRAPH_PROBE(TO_ADJACENCY_MATRIX);
+    return A;
+}
+
+inline DenseGraph::operator SparseAdjacencyMatrix() const {
+    TELEGRAPH_PROBE(TO_SPARSE_ADJACENCY_MATRIX);
+    return A;
+}
+
+inline std::size_t DenseGraph::order() const { return A.rows() - ntomb; }
+
+inline std::size_t DenseGraph::size() const { return m; }
+
+inline MemoryUsage DenseGraph::memory_usage() const {
+    MemoryUsage out = AbstractGraph::memory_usage();
+    out.adjacency = A.heap_size() + heap_size(din) + heap_size(dout);
+    out.slack += A.heap_slack() + heap_slack(din) + heap_slack(dout);
+    return out;
+}
+
+inline void DenseGraph::shrink_to_fit() {
+    AbstractGraph::shrink_to_fit();
+    A.shrink_to_fit();
+    din.shrink_to_fit();
+    dout.shrink_to_fit();
+}
+
+inline std::size_t DenseGraph::capacity() const { return A.capacity(); }
+
+inline void DenseGraph::reserve(std::size_t n) {
+    A.reserve(n);
+    din.reserve(n);
+    dout.reserve(n);
+}
+
+inline const BitMatrix &DenseGraph::adjacency() const { return A; }
 
-inline DenseGraph::operator SparseAdjacencyMatrix() const { return A.sparseView(); }
+inline BitMatrix DenseGraph::reachability_matrix() const { return closure(true); }
 
-inline std::size_t DenseGraph::order() const { return A.rows(); }
+inline DenseGraph DenseGraph::transitive_closure() const {
+    DenseGraph out;
+    out.A = closure(false);
+    out.count_degrees();
+    // Keep the deleted vertex ids.
+    out.deferred = deferred;
+    out.tomb = tomb;
+    out.ntomb = ntomb;
+    return out;
+}
 
-inline std::size_t DenseGraph::size() const {
-    // Cast-view to bool to avoid overflow.
-    return A.cast<bool>().count();
+inline DenseGraph DenseGraph::operator*(const DenseGraph &other) const {
+    DenseGraph out;
+    out.A = A * other.A;
+    out.count_degrees();
+    // Keep the deleted vertex ids of both graphs.
+    if (ntomb > 0 || other.ntomb > 0) {
+        out.deferred = true;
+        out.tomb.assign(std::max(tomb.size(), other.tomb.size()), false);
+        for (VID X = 0; X < out.tomb.size(); X++) {
+            if (!is_tombstone(X) && !other.is_tombstone(X)) continue;
+            out.tomb[X] = true;
+            out.ntomb++;
+        }
+    }
+    return out;
 }
 
-inline bool DenseGraph::has_vertex(const VID &X) const { return X < order(); }
+inline bool DenseGraph::has_vertex(const VID &X) const { return X < A.rows() && !is_tombstone(X); }
 
 inline VID DenseGraph::add_vertex() {
+    TELEGRAPH_PROBE(ADD_VERTEX);
     // Get current matrix size.
-    VID n = order();
-    // Resize the matrix.
-    A.conservativeResize(n + 1, n + 1);
-    // Initialize the allocated memory to zero.
-    A.row(n) *= 0;
-    A.col(n) *= 0;
+    VID n = A.rows();
+    // Resize the matrix, growing its capacity geometrically if needed.
+    A.resize(n + 1);
+    // Initialize counters.
+    din.push_back(0);
+    dout.push_back(0);
+    hash_vertex(n, true);
     // Return new VID.
     return n;
 }
 
 inline void DenseGraph::add_vertex(const VID &X) {
+    TELEGRAPH_PROBE(ADD_VERTEX);
     // Get current matrix size.
-    VID n = order();
+    VID n = A.rows();
     // Check if it is possible to add the requested VID.
     if (X < n) throw ALREADY_DEFINED(X);
     if (X > n) throw std::out_of_range("VID " + std::to_string(X) + " out of range.");
@@ -139,93 +276,153 @@ inline void DenseGraph::add_vertex(const VID &X) {
 }
 
 inline void DenseGraph::del_vertex(const VID &X) {
+    TELEGRAPH_PROBE(DEL_VERTEX);
     if (!has_vertex(X)) throw NOT_DEFINED(X);
-    // Resize matrix.
+    bulk_del_vertices(&X, &X + 1);
+}
 
-    // Get current matrix size.
-    std::size_t n = order();
-    // Delete associated label.
-    auto i = vlbs.left.find(X);
-    if (i != vlbs.left.end()) vlbs.left.erase(i);
-    // Update labels keys after X.
-    for (VID k = X; k < n; k++) {
-        // Check if vertex has label.
-        auto p = vlbs.left.find(k);
-        if (p != vlbs.left.end()) {
-            vlbs.left.modify_key(p, boost::bimaps::_key = (k - 1));
-        }
-    }
-    // Delete associated attributes.
-    auto j = vattrs.find(X);
-    if (j != vattrs.end()) vattrs.erase(j);
-    // Update attributes keys after X.
-    for (VID k = X; k < n; k++) {
-        // Check if vertex has attributes.
-        auto p = vattrs.find(k);
-        if (p != vattrs.end()) {
-            auto pair = vattrs.extract(p);   // Extract pair from map.
-            pair.key() = k - 1;              // Decrease key.
-            vattrs.insert(std::move(pair));  // Move pair back into map.
-        }
-    }
+inline std::size_t DenseGraph::in_degree(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    return din[X];
+}
+
+inline std::size_t DenseGraph::out_degree(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    return dout[X];
 }
 
 inline bool DenseGraph::has_edge(const EID &X) const {
+    TELEGRAPH_PROBE(HAS_EDGE);
     if (!has_vertex(X.first)) throw NOT_DEFINED(X.first);
     if (!has_vertex(X.second)) throw NOT_DEFINED(X.second);
-    return A(X.first, X.second) != 0;
+    return A.test(X.first, X.second);
 }
 
 inline void DenseGraph::add_edge(const EID &X) {
+    TELEGRAPH_PROBE(ADD_EDGE);
     if (has_edge(X)) throw ALREADY_DEFINED(X.first, X.second);
-    A(X.first, X.second) = 1;
+    A.set(X.first, X.second);
+    // Update counters.
+    m++;
+    dout[X.first]++;
+    din[X.second]++;
+    hash_edge(X, true);
 }
 
 inline void DenseGraph::del_edge(const EID &X) {
+    TELEGRAPH_PROBE(DEL_EDGE);
     if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);
-    A(X.first, X.second) = 0;
-    // Delete associated label.
-    auto i = elbs.left.find(X);
-    if (i != elbs.left.end()) elbs.left.erase(i);
-    // Delete associated attributes.
-    auto j = eattrs.find(X);
-    if (j != eattrs.end()) eattrs.erase(j);
-}
-
-inline std::size_t DenseGraph::hash() const {
-    // Initialize seed hash.
-    std::size_t seed = 0;
+    A.reset(X.first, X.second);
+    // Update counters.
+    m--;
+    dout[X.first]--;
+    din[X.second]--;
+    hash_edge(X, false);
+    // Delete associated label and attributes.
+    del_edge_metadata(X);
+}
+
+inline void DenseGraph::bulk_add_edges(const EID *first, const EID *last) {
+    check_edges(first, last);
+    // Sort a copy of the sequence, if needed, to set the edges in row order.
+    std::vector<EID> E;
+    if (!std::is_sorted(first, last)) {
+        E.assign(first, last);
+        std::sort(E.begin(), E.end());
+        first = E.data();
+        last = E.data() + E.size();
+    }
+    // Set the edges, skipping the existing ones.
+    for (const EID *e = first; e != last; e++) {
+        if (!A.test(e->first, e->second)) {
+            A.set(e->first, e->second);
+            // Update counters.
+            m++;
+            dout[e->first]++;
+            din[e->second]++;
+            hash_edge(*e, true);
+        }
+    }
+}
+
+inline void DenseGraph::bulk_del_edges(const EID *first, const EID *last) {
+    check_edges(first, last);
+    // Reset the edges, skipping the missing ones.
+    for (const EID *e = first; e != last; e++) {
+        if (A.test(e->first, e->second)) {
+            A.reset(e->first, e->second);
+            // Update counters.
+            m--;
+            dout[e->first]--;
+            din[e->second]--;
+            hash_edge(*e, false);
+            // Delete associated label and attributes.
+            del_edge_metadata(*e);
+        }
+    }
+}
+
+inline void DenseGraph::compact_vertices(const VID *first, const VID *last) {
     // Get current matrix size.
-    std::size_t n = order();
-    // Hash VIDs.
-    for (VID i = 0; i < n; i++) boost::hash_combine(seed, i);
-    // Hash EIDs.
+    std::size_t n = A.rows();
+    // Build the compaction map.
+    std::vector<VID> remap = compaction_map(first, last, n);
+    // Move each kept row up in place, compacting its columns into a buffer,
+    // since the new position of a row is never after the current one.
+    std::vector<BitMatrix::Word> r(A.stride());
     for (VID i = 0; i < n; i++) {
-        for (VID j = 0; j < n; j++) {
-            if (A(i, j) != 0) boost::hash_combine(seed, EID(i, j));
+        if (remap[i] == NONE) continue;
+        std::fill(r.begin(), r.end(), 0);
+        for (VID j = A.next(i, 0); j < n; j = A.next(i, j + 1)) {
+            VID k = remap[j];
+            if (k != NONE) r[k / BitMatrix::WORD_BITS] |= BitMatrix::Word(1) << (k % BitMatrix::WORD_BITS);
         }
+        std::copy(r.begin(), r.end(), A.row(remap[i]));
     }
-    // Hash GLB.
-    if (has_label()) boost::hash_combine(seed, glb);
-    // Hash VLBs.
-    boost::hash_combine(seed, boost::hash_range(vlbs.begin(), vlbs.end()));
-    // Hash ELBs.
-    boost::hash_combine(seed, boost::hash_range(elbs.begin(), elbs.end()));
-    // Return hash
-    return seed;
+    // Drop the trailing rows and columns, keeping the capacity.
+    A.resize(n - (last - first));
+    // Recount edges and degrees.
+    count_degrees();
+    // Remap labels and attributes.
+    remap_metadata(remap);
+}
+
+inline bool DenseGraph::next_child(const VID &X, std::size_t &i, VID &Y) const {
+    // Find the next set column, skipping zero words.
+    Y = A.next(X, i);
+    if (Y >= A.rows()) return false;
+    i = Y + 1;
+    return true;
+}
+
+inline bool DenseGraph::next_parent(const VID &X, std::size_t &i, VID &Y) const {
+    // Get current matrix size.
+    std::size_t n = A.rows();
+    // Skip the scan if X has no parents.
+    if (din[X] == 0) return false;
+    // Scan the column of X, a bit per row.
+    for (; i < n; i++) {
+        if (A.test(i, X)) {
+            Y = i++;
+            return true;
+        }
+    }
+    return false;
 }
 
 void DenseGraph::print(std::ostream &out) const {
     // Get current matrix size.
-    std::size_t n = order();
+    std::size_t n = A.rows();
 
     // Print graph class.
     out << "DenseGraph( ";
 
     // Print vertex set.
     out << "V = ( ";
-    // Iterate over vertices.
-    for (VID i = 0; i < n; i++) out << i << ", ";
+    // Iterate over vertices, skipping tombstones.
+    for (VID i = 0; i < n; i++) {
+        if (!is_tombstone(i)) out << i << ", ";
+    }
     // Close vertex set.
     out << " )";
 
@@ -233,11 +430,8 @@ void DenseGraph::print(std::ostream &out) const {
     out << ", E = ( ";
     // Iterate over vertices.
     for (VID i = 0; i < n; i++) {
-        for (VID j = 0; j < n; j++) {
-            if (A(i, j) != 0) out << "(" << i << ", " << j << "), ";
-        }
+        for (VID j = A.next(i, 0); j < n; j = A.next(i, j + 1)) out << "(" << i << ", " << j << "), ";
     }
-    for (VID i = 0; i < n - 1; i++) out << i << ", ";
     // Close edge set.
     out << " )";
 
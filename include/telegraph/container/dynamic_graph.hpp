@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "../interface/abstract_graph.ipp"
+#include "neighbor_set.ipp"
+
+/**
+ * @brief Adjacency sets graph for high-churn workloads.
+ *
+ * Each vertex owns two open-addressing sets, one for its children and one
+ * for its parents, so that adding or deleting a vertex or an edge never
+ * reallocates the whole structure: edge mutations run in amortized constant
+ * time and adding a vertex appends two empty sets.
+ */
+class DynamicGraph : public AbstractGraph {
+   protected:
+    //! Out-adjacency sets, aka children.
+    std::vector<NeighborSet> ch;
+    //! In-adjacency sets, aka parents.
+    std::vector<NeighborSet> pa;
+    //! Number of edges.
+    std::size_t m;
+
+    /**
+     * @brief Children of a given vertex in sorted order.
+     *
+     * @param X Given vertex id.
+     * @return std::vector<VID> Sorted children VIDs.
+     */
+    inline std::vector<VID> sorted_children(const VID &X) const;
+
+   public:
+    // Expose the label-based overloads hidden by the overrides below.
+    using AbstractGraph::add_edge;
+    using AbstractGraph::add_vertex;
+    using AbstractGraph::del_edge;
+    using AbstractGraph::del_vertex;
+    using AbstractGraph::has_edge;
+    using AbstractGraph::has_vertex;
+
+    DynamicGraph();
+
+    DynamicGraph(const DynamicGraph &other);
+
+    DynamicGraph &operator=(const DynamicGraph &other);
+
+    /**
+     * @brief Swap the content of two graphs.
+     *
+     * @param other Given graph.
+     */
+    inline void swap(DynamicGraph &other);
+
+    virtual ~DynamicGraph();
+
+    explicit DynamicGraph(std::size_t n);
+
+    /**
+     * @brief Construct a new Dynamic Graph object from VIDs iterators.
+     *
+     * Construct a new Dynamic Graph object from a pair of VIDs iterators.
+     * Let *n* be the size of the sequence of VIDs V, each VID in V is assumed
+     * to be (1) *unique* and (2) *between 0 and n-1*.
+     *
+     * The sequence is *not* required to be ordered, *nor* locally stored.
+     *
+     * @tparam I Iterator typename.
+     * @tparam require_iter_value_type(I, VID) Require the iterator value type to be VID.
+     * @param begin First iterator.
+     * @param end Last iterator.
+     */
+    template <typename I, require_iter_value_type(I, VID) = 0>
+    DynamicGraph(const I &begin, const I &end);
+
+    /**
+     * @brief Construct a new Dynamic Graph object from EIDs iterators.
+     *
+     * Construct a new Dynamic Graph object from a pair of EIDs iterators.
+     * Each EID in the sequence of EIDs is assumed to be *unique*.
+     * Let V be the hypothetical sequence of VIDs given the sequence of EIDs.
+     * Let *n* be the size of the sequence of VIDs V, each VID in V is assumed
+     * to be (1) *unique* and (2) *between 0 and n-1*.
+     *
+     * The sequence is *not* required to be ordered, *nor* locally stored.
+     *
+     * @tparam I Iterator typename.
+     * @tparam require_iter_value_type(I, EID) Require the iterator value type to be EID.
+     * @param begin First iterator.
+     * @param end Last iterator.
+     */
+    template <typename I, require_iter_value_type(I, EID) = 0>
+    DynamicGraph(const I &begin, const I &end);
+
+    explicit DynamicGraph(const AdjacencyList &other);
+
+    explicit DynamicGraph(const AdjacencyMatrix &other);
+
+    explicit DynamicGraph(const SparseAdjacencyMatrix &other);
+
+    inline virtual operator AdjacencyList() const override;
+
+    inline virtual operator AdjacencyMatrix() const override;
+
+    inline virtual operator SparseAdjacencyMatrix() const override;
+
+    inline virtual std::size_t order() const override;
+
+    inline virtual std::size_t size() const override;
+
+    inline virtual MemoryUsage memory_usage() const override;
+
+    inline virtual void shrink_to_fit() override;
+
+    inline virtual bool has_vertex(const VID &X) const override;
+
+    inline virtual VID add_vertex() override;
+
+    inline virtual void add_vertex(const VID &X) override;
+
+    inline virtual void del_vertex(const VID &X) override;
+
+    inline virtual std::size_t in_degree(const VID &X) const override;
+
+    inline virtual std::size_t out_degree(const VID &X) const override;
+
+    inline virtual bool has_edge(const EID &X) const override;
+
+    inline virtual void add_edge(const EID &X) override;
+
+    inline virtual void del_edge(const EID &X) override;
+
+   protected:
+    inline virtual void compact_vertices(const VID *first, const VID *last) override;
+
+    inline virtual void bulk_add_edges(const EID *first, const EID *last) override;
+
+    inline virtual void bulk_del_edges(const EID *first, const EID *last) override;
+
+    inline virtual bool next_child(const VID &X, std::size_t &i, VID &Y) const override;
+
+    inline virtual bool next_parent(const VID &X, std::size_t &i, VID &Y) const override;
+
+   private:
+    virtual void print(std::ostream &out) const override;
+};
@@ -0,0 +1,351 @@
+#pragma once
+
+#include "dynamic_graph.hpp"
+
+inline std::vector<VID> DynamicGraph::sorted_children(const VID &X) const {
+    std::vector<VID> out;
+    out.reserve(ch[X].size());
+    ch[X].for_each([&](const VID &Y) { out.push_back(Y); });
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+DynamicGraph::DynamicGraph() : m(0) {}
+
+DynamicGraph::DynamicGraph(const DynamicGraph &other) : AbstractGraph(other), ch(other.ch), pa(other.pa), m(other.m) {}
+
+DynamicGraph &DynamicGraph::operator=(const DynamicGraph &other) {
+    DynamicGraph tmp(other);
+    swap(tmp);
+    return *this;
+}
+
+inline void DynamicGraph::swap(DynamicGraph &other) {
+    AbstractGraph::swap(other);
+    std::swap(ch, other.ch);
+    std::swap(pa, other.pa);
+    std::swap(m, other.m);
+}
+
+DynamicGraph::~DynamicGraph() {}
+
+DynamicGraph::DynamicGraph(std::size_t n) : ch(n), pa(n), m(0) {}
+
+template <typename I, require_iter_value_type(I, VID)>
+DynamicGraph::DynamicGraph(const I &begin, const I &end) : m(0) {
+    // Since each VID in V is assumed to be (1) *unique* and (2) *between 0 and n-1*,
+    // it is sufficient to count the number of VIDs between [begin, end).
+    VID n = std::distance(begin, end);
+    // Allocate empty adjacency sets.
+    ch.resize(n);
+    pa.resize(n);
+}
+
+template <typename I, require_iter_value_type(I, EID)>
+DynamicGraph::DynamicGraph(const I &begin, const I &end) : m(0) {
+    // Collect the EIDs, since the sequence is assumed to be *not* locally stored.
+    std::vector<EID> E(begin, end);
+    // Each VID in V is assumed to be (1) *unique* and (2) *between 0 and n-1*,
+    // hence it is sufficient to find the highest VID to allocate the sets once.
+    VID n = 0;
+    for (const auto &e : E) n = std::max({n, e.first + 1, e.second + 1});
+    // Allocate empty adjacency sets.
+    ch.resize(n);
+    pa.resize(n);
+    // Set the edges in bulk.
+    add_edges(E.begin(), E.end());
+}
+
+DynamicGraph::DynamicGraph(const AdjacencyList &other) : m(0) {
+    // Given that the adjacency list *is* locally stored, it is possible to
+    // check whether each VID in V is (1) *unique* and (2) *between 0 and n-1* or not.
+
+    // Check if the sequence is non-empty.
+    if (!other.empty()) {
+        // Get maximum VID in the sorted adjacency list and allign to size.
+        VID n = other.rbegin()->first + 1;
+        // Since the adjacency list is sorted, each VID in V is (1) *unique* by default,
+        // we still need to check if each VID is (2) *between 0 and n-1* or not.
+        if (n != other.size()) throw std::invalid_argument("AdjacencyList must contain VIDs *between 0 and size-1*.");
+        // Allocate empty adjacency sets.
+        ch.resize(n);
+        pa.resize(n);
+        // Fill the sets.
+        for (const auto &[v, adj] : other) {
+            ch[v].reserve(adj.size());
+            for (const auto &u : adj) {
+                // Check EID if is inconsistent with given VIDs.
+                if (other.find(u) == other.end()) throw std::out_of_range("AdjacencyList ill formed.");
+                // Set the edge.
+                ch[v].insert(u);
+                pa[u].insert(v);
+                m++;
+            }
+        }
+    }
+}
+
+DynamicGraph::DynamicGraph(const AdjacencyMatrix &other) : m(0) {
+    if (other.rows() != other.cols()) throw std::invalid_argument("AdjacencyMatrix must be squared.");
+    // Allocate empty adjacency sets.
+    ch.resize(other.rows());
+    pa.resize(other.rows());
+    // Iterate over rows and columns as AdjacencyMatrix is RowMajor.
+    for (std::size_t i = 0; i < ch.size(); i++) {
+        for (std::size_t j = 0; j < ch.size(); j++) {
+            if (other(i, j) != 0) {
+                ch[i].insert(j);
+                pa[j].insert(i);
+                m++;
+            }
+        }
+    }
+}
+
+DynamicGraph::DynamicGraph(const SparseAdjacencyMatrix &other) : m(0) {
+    if (other.rows() != other.cols()) throw std::invalid_argument("AdjacencyMatrix must be squared.");
+    // Allocate empty adjacency sets.
+    ch.resize(other.rows());
+    pa.resize(other.rows());
+    // Iterate over the non-zero cells only.
+    for (Eigen::Index k = 0; k < other.outerSize(); k++) {
+        for (SparseAdjacencyMatrix::InnerIterator it(other, k); it; ++it) {
+            if (it.value() != 0 && ch[it.row()].insert(it.col())) {
+                pa[it.col()].insert(it.row());
+                m++;
+            }
+        }
+    }
+}
+
+inline DynamicGraph::operator AdjacencyList() const {
+    TELEGRAPH_PROBE(TO_ADJACENCY_LIST);
+    // Set out parameter.
+    AdjacencyList out;
+    // Get current number of vertices.
+    std::size_t n = ch.size();
+    // Iterate over vertices with children, the adjacency list sorts them.
+    for (std::size_t i = 0; i < n; i++) {
+        if (!ch[i].empty()) ch[i].for_each([&](const VID &j) { out[i].insert(j); });
+    }
+    return out;
+}
+
+inline DynamicGraph::operator AdjacencyMatrix() const {
+    TELEGRAPH_PROBE(TO_ADJACENCY_MATRIX);
+    // Get current number of vertices.
+    std::size_t n = ch.size();
+    // Allocate a squared zero matrix.
+    AdjacencyMatrix out = AdjacencyMatrix::Zero(n, n);
+    // Set the edges.
+    for (std::size_t i = 0; i < n; i++) ch[i].for_each([&](const VID &j) { out(i, j) = 1; });
+    return out;
+}
+
+inline DynamicGraph::operator SparseAdjacencyMatrix() const {
+    TELEGRAPH_PROBE(TO_SPARSE_ADJACENCY_MATRIX);
+    // Get current number of vertices.
+    std::size_t n = ch.size();
+    SparseAdjacencyMatrix out(n, n);
+    // Reserve the exact number of non-zeros per row.
+    Eigen::VectorXi nnz(n);
+    for (std::size_t i = 0; i < n; i++) nnz(i) = ch[i].size();
+    out.reserve(nnz);
+    // Insert sorted children in row order, which is the storage order.
+    for (std::size_t i = 0; i < n; i++) {
+        for (const VID &j : sorted_children(i)) out.insert(i, j) = 1;
+    }
+    out.makeCompressed();
+    return out;
+}
+
+inline std::size_t DynamicGraph::order() const { return ch.size() - ntomb; }
+
+inline std::size_t DynamicGraph::size() const { return m; }
+
+inline MemoryUsage DynamicGraph::memory_usage() const {
+    MemoryUsage out = AbstractGraph::memory_usage();
+    out.adjacency = heap_size(ch) + heap_size(pa);
+    out.slack += heap_slack(ch) + heap_slack(pa);
+    for (std::size_t i = 0; i < ch.size(); i++) {
+        out.adjacency += ch[i].heap_size() + pa[i].heap_size();
+        out.slack += ch[i].heap_slack() + pa[i].heap_slack();
+    }
+    return out;
+}
+
+inline void DynamicGraph::shrink_to_fit() {
+    AbstractGraph::shrink_to_fit();
+    for (std::size_t i = 0; i < ch.size(); i++) {
+        ch[i].shrink_to_fit();
+        pa[i].shrink_to_fit();
+    }
+    ch.shrink_to_fit();
+    pa.shrink_to_fit();
+}
+
+inline bool DynamicGraph::has_vertex(const VID &X) const { return X < ch.size() && !is_tombstone(X); }
+
+inline VID DynamicGraph::add_vertex() {
+    TELEGRAPH_PROBE(ADD_VERTEX);
+    // Get current number of vertices.
+    VID n = ch.size();
+    // Append empty adjacency sets.
+    ch.emplace_back();
+    pa.emplace_back();
+    hash_vertex(n, true);
+    // Return new VID.
+    return n;
+}
+
+inline void DynamicGraph::add_vertex(const VID &X) {
+    TELEGRAPH_PROBE(ADD_VERTEX);
+    // Get current number of vertices.
+    VID n = ch.size();
+    // Check if it is possible to add the requested VID.
+    if (X < n) throw ALREADY_DEFINED(X);
+    if (X > n) throw std::out_of_range("VID " + std::to_string(X) + " out of range.");
+    // Add requested vertex.
+    add_vertex();
+}
+
+inline void DynamicGraph::del_vertex(const VID &X) {
+    TELEGRAPH_PROBE(DEL_VERTEX);
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    bulk_del_vertices(&X, &X + 1);
+}
+
+inline std::size_t DynamicGraph::in_degree(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    return pa[X].size();
+}
+
+inline std::size_t DynamicGraph::out_degree(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    return ch[X].size();
+}
+
+inline bool DynamicGraph::has_edge(const EID &X) const {
+    TELEGRAPH_PROBE(HAS_EDGE);
+    if (!has_vertex(X.first)) throw NOT_DEFINED(X.first);
+    if (!has_vertex(X.second)) throw NOT_DEFINED(X.second);
+    return ch[X.first].contains(X.second);
+}
+
+inline void DynamicGraph::add_edge(const EID &X) {
+    TELEGRAPH_PROBE(ADD_EDGE);
+    if (has_edge(X)) throw ALREADY_DEFINED(X.first, X.second);
+    ch[X.first].insert(X.second);
+    pa[X.second].insert(X.first);
+    m++;
+    hash_edge(X, true);
+}
+
+inline void DynamicGraph::del_edge(const EID &X) {
+    TELEGRAPH_PROBE(DEL_EDGE);
+    if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);
+    ch[X.first].erase(X.second);
+    pa[X.second].erase(X.first);
+    m--;
+    hash_edge(X, false);
+    // Delete associated label and attributes.
+    del_edge_metadata(X);
+}
+
+inline void DynamicGraph::bulk_add_edges(const EID *first, const EID *last) {
+    check_edges(first, last);
+    // Insert the edges, skipping the existing ones.
+    for (const EID *e = first; e != last; e++) {
+        if (ch[e->first].insert(e->second)) {
+            pa[e->second].insert(e->first);
+            m++;
+            hash_edge(*e, true);
+        }
+    }
+}
+
+inline void DynamicGraph::bulk_del_edges(const EID *first, const EID *last) {
+    check_edges(first, last);
+    // Erase the edges, skipping the missing ones.
+    for (const EID *e = first; e != last; e++) {
+        if (ch[e->first].erase(e->second)) {
+            pa[e->second].erase(e->first);
+            m--;
+            hash_edge(*e, false);
+            // Delete associated label and attributes.
+            del_edge_metadata(*e);
+        }
+    }
+}
+
+inline void DynamicGraph::compact_vertices(const VID *first, const VID *last) {
+    // Get current number of vertices.
+    std::size_t n = ch.size();
+    // Build the compaction map.
+    std::vector<VID> remap = compaction_map(first, last, n);
+    // Rebuild the adjacency sets of the kept vertices in a single pass.
+    auto compact = [&](std::vector<NeighborSet> &S) {
+        std::vector<NeighborSet> T(n - (last - first));
+        for (VID i = 0; i < n; i++) {
+            if (remap[i] == NONE) continue;
+            NeighborSet &U = T[remap[i]];
+            U.reserve(S[i].size());
+            S[i].for_each([&](const VID &Y) {
+                if (remap[Y] != NONE) U.insert(remap[Y]);
+            });
+        }
+        S = std::move(T);
+    };
+    compact(ch);
+    compact(pa);
+    // Recount the edges.
+    m = 0;
+    for (const auto &S : ch) m += S.size();
+    // Remap labels and attributes.
+    remap_metadata(remap);
+}
+
+inline bool DynamicGraph::next_child(const VID &X, std::size_t &i, VID &Y) const {
+    // Find the next non-empty slot.
+    i = ch[X].next(i);
+    if (i >= ch[X].capacity()) return false;
+    Y = ch[X][i++];
+    return true;
+}
+
+inline bool DynamicGraph::next_parent(const VID &X, std::size_t &i, VID &Y) const {
+    // Find the next non-empty slot.
+    i = pa[X].next(i);
+    if (i >= pa[X].capacity()) return false;
+    Y = pa[X][i++];
+    return true;
+}
+
+void DynamicGraph::print(std::ostream &out) const {
+    // Get current number of vertices.
+    std::size_t n = ch.size();
+
+    // Print graph class.
+    out << "DynamicGraph( ";
+
+    // Print vertex set.
+    out << "V = ( ";
+    // Iterate over vertices, skipping tombstones.
+    for (VID i = 0; i < n; i++) {
+        if (!is_tombstone(i)) out << i << ", ";
+    }
+    // Close vertex set.
+    out << " )";
+
+    // Print edge set.
+    out << ", E = ( ";
+    // Iterate over edges in sorted order.
+    for (VID i = 0; i < n; i++) {
+        for (const VID &j : sorted_children(i)) out << "(" << i << ", " << j << "), ";
+    }
+    // Close edge set.
+    out << " )";
+
+    // Close graph class.
+    out << " )" << std::endl;
+}
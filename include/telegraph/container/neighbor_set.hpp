@@ -0,0 +1,145 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "../interface/interface_graph.ipp"
+
+/**
+ * @brief Open-addressing set of VIDs.
+ *
+ * VIDs are stored in a flat power-of-two table with linear probing and
+ * backward-shift deletion, hence there are no tombstones and both insertion
+ * and deletion run in amortized constant time. Iteration walks the table
+ * slots in memory order, skipping the empty ones.
+ */
+class NeighborSet {
+   public:
+    //! Empty slot marker.
+    static constexpr VID EMPTY = std::numeric_limits<VID>::max();
+    //! Minimum number of slots of a non-empty table.
+    static constexpr std::size_t MIN_CAPACITY = 4;
+
+   protected:
+    //! Table slots.
+    std::vector<VID> slots;
+    //! Number of stored VIDs.
+    std::size_t n;
+    //! Base-2 logarithm of the number of slots.
+    std::size_t bits;
+
+    /**
+     * @brief Home slot of a given VID.
+     *
+     * @param X Given VID.
+     * @return std::size_t Home slot index.
+     */
+    inline std::size_t home(const VID &X) const;
+
+    /**
+     * @brief Slot holding a given VID.
+     *
+     * @param X Given VID.
+     * @return std::size_t Slot index, capacity() if not found.
+     */
+    inline std::size_t find(const VID &X) const;
+
+    /**
+     * @brief Rebuild the table with a given number of slots.
+     *
+     * @param k Given number of slots, a power of two.
+     */
+    inline void rehash(std::size_t k);
+
+    /**
+     * @brief Smallest capacity holding a given number of VIDs.
+     *
+     * @param k Given number of VIDs.
+     * @return std::size_t Capacity, a power of two.
+     */
+    static inline std::size_t fit(std::size_t k);
+
+   public:
+    //! Default constructor for an empty Neighbor Set object.
+    NeighborSet();
+
+    //! Number of stored VIDs.
+    inline std::size_t size() const;
+
+    //! Whether the set is empty or not.
+    inline bool empty() const;
+
+    //! Number of table slots.
+    inline std::size_t capacity() const;
+
+    /**
+     * @brief Reserve slots for a given number of VIDs.
+     *
+     * @param k Given number of VIDs.
+     */
+    inline void reserve(std::size_t k);
+
+    /**
+     * @brief Whether a VID is stored or not.
+     *
+     * @param X Given VID.
+     * @return true If the VID is stored,
+     * @return false Otherwise.
+     */
+    inline bool contains(const VID &X) const;
+
+    /**
+     * @brief Insert a VID.
+     *
+     * @param X Given VID.
+     * @return true If the VID has been inserted,
+     * @return false If the VID was already stored.
+     */
+    inline bool insert(const VID &X);
+
+    /**
+     * @brief Erase a VID.
+     *
+     * @param X Given VID.
+     * @return true If the VID has been erased,
+     * @return false If the VID was not stored.
+     */
+    inline bool erase(const VID &X);
+
+    //! Erase all VIDs and release the table.
+    inline void clear();
+
+    //! Shrink the table to the smallest capacity holding the VIDs, release it if empty.
+    inline void shrink_to_fit();
+
+    //! Heap bytes of the table.
+    inline std::size_t heap_size() const;
+
+    //! Heap bytes of the table released by shrink_to_fit.
+    inline std::size_t heap_slack() const;
+
+    /**
+     * @brief Get the VID stored in a given slot.
+     *
+     * @param i Given slot index.
+     * @return const VID& Stored VID, EMPTY if the slot is empty.
+     */
+    inline const VID &operator[](std::size_t i) const;
+
+    /**
+     * @brief Find the next non-empty slot.
+     *
+     * @param i Given starting slot index, included.
+     * @return std::size_t Next non-empty slot index, capacity() if none.
+     */
+    inline std::size_t next(std::size_t i) const;
+
+    /**
+     * @brief Apply a function to each stored VID.
+     *
+     * @tparam F Function typename.
+     * @param f Given function.
+     */
+    template <typename F>
+    inline void for_each(F f) const;
+};
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "neighbor_set.hpp"
+
+inline std::size_t NeighborSet::home(const VID &X) const {
+    // Fibonacci hashing, take the high bits of the product.
+    return (X * 0x9E3779B97F4A7C15ULL) >> (64 - bits);
+}
+
+inline std::size_t NeighborSet::find(const VID &X) const {
+    if (n == 0) return capacity();
+    // Probe linearly from the home slot until an empty slot is found.
+    const std::size_t mask = capacity() - 1;
+    for (std::size_t i = home(X);; i = (i + 1) & mask) {
+        if (slots[i] == X) return i;
+        if (slots[i] == EMPTY) return capacity();
+    }
+}
+
+inline void NeighborSet::rehash(std::size_t k) {
+    // Swap in a new empty table.
+    std::vector<VID> old(k, EMPTY);
+    std::swap(slots, old);
+    bits = __builtin_ctzll(k);
+    n = 0;
+    // Reinsert the stored VIDs.
+    for (const VID &X : old) {
+        if (X != EMPTY) insert(X);
+    }
+}
+
+NeighborSet::NeighborSet() : n(0), bits(0) {}
+
+inline std::size_t NeighborSet::size() const { return n; }
+
+inline bool NeighborSet::empty() const { return n == 0; }
+
+inline std::size_t NeighborSet::capacity() const { return slots.size(); }
+
+inline std::size_t NeighborSet::fit(std::size_t k) {
+    // Keep the load factor below 3/4.
+    std::size_t c = MIN_CAPACITY;
+    while (4 * k > 3 * c) c *= 2;
+    return c;
+}
+
+inline void NeighborSet::reserve(std::size_t k) {
+    std::size_t c = fit(k);
+    if (c > capacity()) rehash(c);
+}
+
+inline bool NeighborSet::contains(const VID &X) const { return find(X) != capacity(); }
+
+inline bool NeighborSet::insert(const VID &X) {
+    // Grow the table geometrically to keep the load factor below 3/4.
+    if (4 * (n + 1) > 3 * capacity()) rehash(std::max(MIN_CAPACITY, 2 * capacity()));
+    // Probe linearly from the home slot until X or an empty slot is found.
+    const std::size_t mask = capacity() - 1;
+    std::size_t i = home(X);
+    for (; slots[i] != EMPTY; i = (i + 1) & mask) {
+        if (slots[i] == X) return false;
+    }
+    slots[i] = X;
+    n++;
+    return true;
+}
+
+inline bool NeighborSet::erase(const VID &X) {
+    std::size_t i = find(X);
+    if (i == capacity()) return false;
+    // Shift back the following entries of the probe sequence to fill the hole.
+    const std::size_t mask = capacity() - 1;
+    for (std::size_t j = (i + 1) & mask; slots[j] != EMPTY; j = (j + 1) & mask) {
+        std::size_t k = home(slots[j]);
+        // Skip entries whose home slot lies cyclically in (i, j].
+        if (i <= j ? (i < k && k <= j) : (i < k || k <= j)) continue;
+        slots[i] = slots[j];
+        i = j;
+    }
+    slots[i] = EMPTY;
+    n--;
+    return true;
+}
+
+inline void NeighborSet::clear() {
+    std::vector<VID>().swap(slots);
+    n = 0;
+    bits = 0;
+}
+
+inline void NeighborSet::shrink_to_fit() {
+    if (n == 0) {
+        clear();
+    } else if (fit(n) < capacity()) {
+        rehash(fit(n));
+    }
+}
+
+inline std::size_t NeighborSet::heap_size() const { return ::heap_size(slots); }
+
+inline std::size_t NeighborSet::heap_slack() const {
+    if (n == 0) return heap_size();
+    return heap_size() - std::min(fit(n), capacity()) * sizeof(VID);
+}
+
+inline const VID &NeighborSet::operator[](std::size_t i) const { return slots[i]; }
+
+inline std::size_t NeighborSet::next(std::size_t i) const {
+    for (; i < capacity(); i++) {
+        if (slots[i] != EMPTY) return i;
+    }
+    return capacity();
+}
+
+template <typename F>
+inline void NeighborSet::for_each(F f) const {
+    for (const VID &X : slots) {
+        if (X != EMPTY) f(X);
+    }
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "../interface/abstract_graph.ipp"
+
+/**
+ * @brief Compressed sparse row graph.
+ *
+ * Edges are stored in a compressed row-major sparse matrix, so that memory
+ * scales with the number of vertices and edges and each neighborhood is a
+ * contiguous sequence of VIDs. Mutations are collected into two sorted delta
+ * buffers, one for inserted and one for deleted edges, which are merged into
+ * the compressed storage once they grow past a threshold. The transposed
+ * matrix and a transposed copy of the inserted edges buffer are kept
+ * alongside to scan parents contiguously too.
+ */
+class SparseGraph : public AbstractGraph {
+   protected:
+    //! Compressed sparse row adjacency matrix.
+    SparseAdjacencyMatrix A;
+    //! Transposed compressed adjacency matrix, i.e. parents of each vertex.
+    SparseAdjacencyMatrix At;
+    //! Sorted buffer of inserted edges not yet merged into A.
+    std::vector<EID> ins;
+    //! Transposed buffer of inserted edges, i.e. (target, source) pairs sorted by target.
+    std::vector<EID> tins;
+    //! Sorted buffer of deleted edges not yet merged from A.
+    std::vector<EID> del;
+    //! In-degree of each vertex.
+    std::vector<std::size_t> din;
+    //! Out-degree of each vertex.
+    std::vector<std::size_t> dout;
+
+    //! Rebuild the transposed matrix and the degrees from A, assuming empty delta buffers.
+    inline void reindex();
+
+    /**
+     * @brief Build a compressed adjacency matrix from a sequence of EIDs.
+     *
+     * @param E Given EIDs, *sorted* and *unique*.
+     * @param n Given number of vertices.
+     * @return SparseAdjacencyMatrix Compressed adjacency matrix.
+     */
+    static inline SparseAdjacencyMatrix from_edges(const std::vector<EID> &E, std::size_t n);
+
+    /**
+     * @brief Maximum number of buffered edges before merging.
+     *
+     * @return std::size_t Threshold on the delta buffers size.
+     */
+    inline std::size_t threshold() const;
+
+    /**
+     * @brief Whether an edge is stored in the compressed matrix or not.
+     *
+     * @param X Given edge id.
+     * @return true If the edge is stored,
+     * @return false Otherwise.
+     */
+    inline bool has_stored_edge(const EID &X) const;
+
+    /**
+     * @brief The compressed adjacency matrix with the delta buffers applied.
+     *
+     * @return SparseAdjacencyMatrix Merged compressed adjacency matrix.
+     */
+    inline SparseAdjacencyMatrix merged() const;
+
+    //! Merge the delta buffers into the compressed adjacency matrix.
+    inline void merge();
+
+   public:
+    // Expose the label-based overloads hidden by the overrides below.
+    using AbstractGraph::add_edge;
+    using AbstractGraph::add_vertex;
+    using AbstractGraph::del_edge;
+    using AbstractGraph::del_vertex;
+    using AbstractGraph::has_edge;
+    using AbstractGraph::has_vertex;
+
+    SparseGraph();
+
+    SparseGraph(const SparseGraph &other);
+
+    SparseGraph &operator=(const SparseGraph &other);
+
+    /**
+     * @brief Swap the content of two graphs.
+     *
+     * @param other Given graph.
+     */
+    inline void swap(SparseGraph &other);
+
+    virtual ~SparseGraph();
+
+    explicit SparseGraph(std::size_t n);
+
+    /**
+     * @brief Construct a new Sparse Graph object from VIDs iterators.
+     *
+     * Construct a new Sparse Graph object from a pair of VIDs iterators.
+     * Let *n* be the size of the sequence of VIDs V, each VID in V is assumed
+     * to be (1) *unique* and (2) *between 0 and n-1*.
+     *
+     * The sequence is *not* required to be ordered, *nor* locally stored.
+     *
+     * @tparam I Iterator typename.
+     * @tparam require_iter_value_type(I, VID) Require the iterator value type to be VID.
+     * @param begin First iterator.
+     * @param end Last iterator.
+     */
+    template <typename I, require_iter_value_type(I, VID) = 0>
+    SparseGraph(const I &begin, const I &end);
+
+    /**
+     * @brief Construct a new Sparse Graph object from EIDs iterators.
+     *
+     * Construct a new Sparse Graph object from a pair of EIDs iterators.
+     * Each EID in the sequence of EIDs is assumed to be *unique*.
+     * Let V be the hypothetical sequence of VIDs given the sequence of EIDs.
+     * Let *n* be the size of the sequence of VIDs V, each VID in V is assumed
+     * to be (1) *unique* and (2) *between 0 and n-1*.
+     *
+     * The sequence is *not* required to be ordered, *nor* locally stored.
+     *
+     * @tparam I Iterator typename.
+     * @tparam require_iter_value_type(I, EID) Require the iterator value type to be EID.
+     * @param begin First iterator.
+     * @param end Last iterator.
+     */
+    template <typename I, require_iter_value_type(I, EID) = 0>
+    SparseGraph(const I &begin, const I &end);
+
+    explicit SparseGraph(const AdjacencyList &other);
+
+    explicit SparseGraph(const AdjacencyMatrix &other);
+
+    explicit SparseGraph(const SparseAdjacencyMatrix &other);
+
+    /**
+     * @brief Construct a new Sparse Graph object taking ownership of a sparse adjacency matrix.
+     *
+     * The compressed storage of the given matrix is moved, not copied.
+     *
+     * @param other Given sparse adjacency matrix.
+     */
+    explicit SparseGraph(SparseAdjacencyMatrix &&other);
+
+    inline virtual operator AdjacencyList() const override;
+
+    inline virtual operator AdjacencyMatrix() const override;
+
+    inline virtual operator SparseAdjacencyMatrix() const override;
+
+    inline virtual std::size_t order() const override;
+
+    inline virtual std::size_t size() const override;
+
+    inline virtual MemoryUsage memory_usage() const override;
+
+    inline virtual void shrink_to_fit() override;
+
+    inline virtual bool has_vertex(const VID &X) const override;
+
+    inline virtual VID add_vertex() override;
+
+    inline virtual void add_vertex(const VID &X) override;
+
+    inline virtual void del_vertex(const VID &X) override;
+
+    inline virtual std::size_t in_degree(const VID &X) const override;
+
+    inline virtual std::size_t out_degree(const VID &X) const override;
+
+    inline virtual bool has_edge(const EID &X) const override;
+
+    inline virtual void add_edge(const EID &X) override;
+
+    inline virtual void del_edge(const EID &X) override;
+
+   protected:
+    inline virtual void compact_vertices(const VID *first, const VID *last) override;
+
+    inline virtual void bulk_add_edges(const EID *first, const EID *last) override;
+
+    inline virtual void bulk_del_edges(const EID *first, const EID *last) override;
+
+    inline virtual bool next_child(const VID &X, std::size_t &i, VID &Y) const override;
+
+    inline virtual bool next_parent(const VID &X, std::size_t &i, VID &Y) const override;
+
+   private:
+    virtual void print(std::ostream &out) const override;
+};
@@ -0,0 +1,497 @@
+#pragma once
+
+#include "sparse_graph.hpp"
+
+inline SparseAdjacencyMatrix SparseGraph::from_edges(const std::vector<EID> &E, std::size_t n) {
+    using Index = SparseAdjacencyMatrix::StorageIndex;
+    // Allocate the compressed storage at once.
+    SparseAdjacencyMatrix out(n, n);
+    out.resizeNonZeros(E.size());
+    Index *outer = out.outerIndexPtr();
+    Index *inner = out.innerIndexPtr();
+    // Fill rows in order, since EIDs are sorted.
+    Index k = 0;
+    auto e = E.begin();
+    for (std::size_t i = 0; i < n; i++) {
+        outer[i] = k;
+        for (; e != E.end() && e->first == i; e++) inner[k++] = e->second;
+    }
+    outer[n] = k;
+    // Set the edges values.
+    std::fill(out.valuePtr(), out.valuePtr() + k, 1);
+    return out;
+}
+
+inline std::size_t SparseGraph::threshold() const {
+    // Balance the cost of sorted insertions against the cost of merging.
+    return std::max<std::size_t>(64, std::sqrt(A.rows() + A.nonZeros()));
+}
+
+inline bool SparseGraph::has_stored_edge(const EID &X) const {
+    const auto *outer = A.outerIndexPtr();
+    const auto *inner = A.innerIndexPtr();
+    // Binary search the sorted row.
+    return std::binary_search(inner + outer[X.first], inner + outer[X.first + 1], X.second);
+}
+
+inline SparseAdjacencyMatrix SparseGraph::merged() const {
+    using Index = SparseAdjacencyMatrix::StorageIndex;
+    // Avoid rebuilding if there is nothing to merge.
+    if (ins.empty() && del.empty()) return A;
+    // Get current matrix size.
+    std::size_t n = A.rows();
+    // Allocate the compressed storage at once.
+    SparseAdjacencyMatrix out(n, n);
+    out.resizeNonZeros(size());
+    const Index *outer = A.outerIndexPtr();
+    const Index *inner = A.innerIndexPtr();
+    Index *o = out.outerIndexPtr();
+    Index *m = out.innerIndexPtr();
+    // Merge sorted rows with sorted buffers in a single pass.
+    Index k = 0;
+    auto p = ins.begin();
+    auto q = del.begin();
+    for (std::size_t i = 0; i < n; i++) {
+        o[i] = k;
+        for (Index t = outer[i]; t < outer[i + 1]; t++) {
+            VID j = inner[t];
+            // Insert buffered edges preceding the stored one.
+            for (; p != ins.end() && p->first == i && p->second < j; p++) m[k++] = p->second;
+            // Skip buffered deletions.
+            if (q != del.end() && q->first == i && q->second == j) {
+                q++;
+                continue;
+            }
+            m[k++] = j;
+        }
+        // Insert remaining buffered edges.
+        for (; p != ins.end() && p->first == i; p++) m[k++] = p->second;
+    }
+    o[n] = k;
+    // Set the edges values.
+    std::fill(out.valuePtr(), out.valuePtr() + k, 1);
+    return out;
+}
+
+inline void SparseGraph::reindex() {
+    // Transpose the compressed matrix.
+    At = A.transpose();
+    // Get current matrix size.
+    std::size_t n = A.rows();
+    const auto *outer = A.outerIndexPtr();
+    const auto *inner = A.innerIndexPtr();
+    // Reset counters.
+    din.assign(n, 0);
+    dout.assign(n, 0);
+    // Out-degrees are row lengths, in-degrees are column occurrences.
+    for (std::size_t i = 0; i < n; i++) dout[i] = outer[i + 1] - outer[i];
+    for (Eigen::Index k = 0; k < A.nonZeros(); k++) din[inner[k]]++;
+}
+
+inline void SparseGraph::merge() {
+    A = merged();
+    ins.clear();
+    tins.clear();
+    del.clear();
+    // Rebuild the transposed matrix.
+    At = A.transpose();
+}
+
+SparseGraph::SparseGraph() {}
+
+SparseGraph::SparseGraph(const SparseGraph &other)
+    : AbstractGraph(other),
+      A(other.A),
+      At(other.At),
+      ins(other.ins),
+      tins(other.tins),
+      del(other.del),
+      din(other.din),
+      dout(other.dout) {}
+
+SparseGraph &SparseGraph::operator=(const SparseGraph &other) {
+    SparseGraph tmp(other);
+    swap(tmp);
+    return *this;
+}
+
+inline void SparseGraph::swap(SparseGraph &other) {
+    AbstractGraph::swap(other);
+    std::swap(A, other.A);
+    std::swap(At, other.At);
+    std::swap(ins, other.ins);
+    std::swap(tins, other.tins);
+    std::swap(del, other.del);
+    std::swap(din, other.din);
+    std::swap(dout, other.dout);
+}
+
+SparseGraph::~SparseGraph() {}
+
+SparseGraph::SparseGraph(std::size_t n) : A(n, n), At(n, n), din(n, 0), dout(n, 0) {}
+
+template <typename I, require_iter_value_type(I, VID)>
+SparseGraph::SparseGraph(const I &begin, const I &end) {
+    // Since each VID in V is assumed to be (1) *unique* and (2) *between 0 and n-1*,
+    // it is sufficient to count the number of VIDs between [begin, end).
+    VID n = std::distance(begin, end);
+    // Allocate an empty matrix.
+    A = SparseAdjacencyMatrix(n, n);
+    At = SparseAdjacencyMatrix(n, n);
+    // Initialize counters.
+    din.assign(n, 0);
+    dout.assign(n, 0);
+}
+
+template <typename I, require_iter_value_type(I, EID)>
+SparseGraph::SparseGraph(const I &begin, const I &end) {
+    // Collect the EIDs, since the sequence is assumed to be *not* locally stored.
+    std::vector<EID> E(begin, end);
+    // Get the highest VID, plus one to align the size.
+    VID n = 0;
+    for (const auto &e : E) n = std::max({n, e.first + 1, e.second + 1});
+    // Sort the EIDs in row order and build the compressed matrix.
+    std::sort(E.begin(), E.end());
+    A = from_edges(E, n);
+    // Initialize counters.
+    reindex();
+}
+
+SparseGraph::SparseGraph(const AdjacencyList &other) {
+    // Given that the adjacency list *is* locally stored, it is possible to
+    // check whether each VID in V is (1) *unique* and (2) *between 0 and n-1* or not.
+
+    // Check if the sequence is non-empty.
+    if (!other.empty()) {
+        // Get maximum VID in the sorted adjacency list and allign to size.
+        VID n = other.rbegin()->first + 1;
+        // Since the adjacency list is sorted, each VID in V is (1) *unique* by default,
+        // we still need to check if each VID is (2) *between 0 and n-1* or not.
+        if (n != other.size()) throw std::invalid_argument("AdjacencyList must contain VIDs *between 0 and size-1*.");
+        // Collect the EIDs, which are already sorted.
+        std::vector<EID> E;
+        for (const auto &[v, adj] : other) {
+            for (const auto &u : adj) {
+                // Check EID if is inconsistent with given VIDs.
+                if (other.find(u) == other.end()) throw std::out_of_range("AdjacencyList ill formed.");
+                E.emplace_back(v, u);
+            }
+        }
+        A = from_edges(E, n);
+    }
+    // Initialize counters.
+    reindex();
+}
+
+SparseGraph::SparseGraph(const AdjacencyMatrix &other) {
+    if (other.rows() != other.cols()) throw std::invalid_argument("AdjacencyMatrix must be squared.");
+    // Keep non-zero cells only.
+    A = other.sparseView();
+    A.makeCompressed();
+    A.coeffs().setOnes();
+    // Initialize counters.
+    reindex();
+}
+
+SparseGraph::SparseGraph(const SparseAdjacencyMatrix &other) : SparseGraph(SparseAdjacencyMatrix(other)) {}
+
+SparseGraph::SparseGraph(SparseAdjacencyMatrix &&other) : A(std::move(other)) {
+    if (A.rows() != A.cols()) throw std::invalid_argument("AdjacencyMatrix must be squared.");
+    // Drop explicitly stored zeros and compress, both are no-ops on well-formed matrices.
+    A.prune([](const Eigen::Index &, const Eigen::Index &, const int8_t &value) { return value != 0; });
+    A.makeCompressed();
+    A.coeffs().setOnes();
+    // Initialize counters.
+    reindex();
+}
+
+inline SparseGraph::operator AdjacencyList() const {
+    TELEGRAPH_PROBE(TO_ADJACENCY_LIST);
+    // Set out parameter.
+    AdjacencyList out;
+    // Apply pending mutations.
+    SparseAdjacencyMatrix B = merged();
+    // Iterate over rows, each one is a sorted contiguous sequence.
+    for (Eigen::Index i = 0; i < B.outerSize(); i++) {
+        for (SparseAdjacencyMatrix::InnerIterator it(B, i); it; ++it) out[i].insert(out[i].end(), it.col());
+    }
+    return out;
+}
+
+inline SparseGraph::operator AdjacencyMatrix() const {
+    TELEGRAPH_PROBE(TO_ADJACENCY_MATRIX);
+    return merged().toDense();
+}
+
+inline SparseGraph::operator SparseAdjacencyMatrix() const {
+    TELEGRAPH_PROBE(TO_SPARSE_ADJACENCY_MATRIX);
+    return merged();
+}
+
+inline std::size_t SparseGraph::order() const { return A.rows() - ntomb; }
+
+inline std::size_t SparseGraph::size() const { return A.nonZeros() + ins.size() - del.size(); }
+
+inline MemoryUsage SparseGraph::memory_usage() const {
+    using Index = SparseAdjacencyMatrix::StorageIndex;
+    MemoryUsage out = AbstractGraph::memory_usage();
+    for (const SparseAdjacencyMatrix *M : {&A, &At}) {
+        // Each nonzero holds a value and an inner index, the uncompressed mode adds the row sizes.
+        const std::size_t nnz = sizeof(int8_t) + sizeof(Index);
+        out.adjacency += M->data().allocatedSize() * nnz + (M->outerSize() + 1) * sizeof(Index);
+        out.slack += (M->data().allocatedSize() - M->nonZeros()) * nnz;
+        if (!M->isCompressed()) {
+            out.adjacency += M->outerSize() * sizeof(Index);
+            out.slack += M->outerSize() * sizeof(Index);
+        }
+    }
+    out.adjacency += heap_size(ins) + heap_size(tins) + heap_size(del) + heap_size(din) + heap_size(dout);
+    out.slack += heap_slack(ins) + heap_slack(tins) + heap_slack(del) + heap_slack(din) + heap_slack(dout);
+    return out;
+}
+
+inline void SparseGraph::shrink_to_fit() {
+    AbstractGraph::shrink_to_fit();
+    // Merge the delta buffers, then release them.
+    if (!ins.empty() || !del.empty()) merge();
+    for (SparseAdjacencyMatrix *M : {&A, &At}) {
+        M->makeCompressed();
+        M->data().squeeze();
+    }
+    std::vector<EID>().swap(ins);
+    std::vector<EID>().swap(tins);
+    std::vector<EID>().swap(del);
+    din.shrink_to_fit();
+    dout.shrink_to_fit();
+}
+
+inline bool SparseGraph::has_vertex(const VID &X) const { return X < (VID)A.rows() && !is_tombstone(X); }
+
+inline VID SparseGraph::add_vertex() {
+    TELEGRAPH_PROBE(ADD_VERTEX);
+    // Get current matrix size.
+    VID n = A.rows();
+    // Resize the matrix, new rows and columns are empty.
+    A.conservativeResize(n + 1, n + 1);
+    A.makeCompressed();
+    At.conservativeResize(n + 1, n + 1);
+    At.makeCompressed();
+    // Initialize counters.
+    din.push_back(0);
+    dout.push_back(0);
+    hash_vertex(n, true);
+    // Return new VID.
+    return n;
+}
+
+inline void SparseGraph::add_vertex(const VID &X) {
+    TELEGRAPH_PROBE(ADD_VERTEX);
+    // Get current matrix size.
+    VID n = A.rows();
+    // Check if it is possible to add the requested VID.
+    if (X < n) throw ALREADY_DEFINED(X);
+    if (X > n) throw std::out_of_range("VID " + std::to_string(X) + " out of range.");
+    // Add requested vertex.
+    add_vertex();
+}
+
+inline void SparseGraph::del_vertex(const VID &X) {
+    TELEGRAPH_PROBE(DEL_VERTEX);
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    bulk_del_vertices(&X, &X + 1);
+}
+
+inline std::size_t SparseGraph::in_degree(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    return din[X];
+}
+
+inline std::size_t SparseGraph::out_degree(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    return dout[X];
+}
+
+inline bool SparseGraph::has_edge(const EID &X) const {
+    TELEGRAPH_PROBE(HAS_EDGE);
+    if (!has_vertex(X.first)) throw NOT_DEFINED(X.first);
+    if (!has_vertex(X.second)) throw NOT_DEFINED(X.second);
+    // Check stored edges first, then the delta buffers.
+    if (has_stored_edge(X)) return !std::binary_search(del.begin(), del.end(), X);
+    return std::binary_search(ins.begin(), ins.end(), X);
+}
+
+inline void SparseGraph::add_edge(const EID &X) {
+    TELEGRAPH_PROBE(ADD_EDGE);
+    if (has_edge(X)) throw ALREADY_DEFINED(X.first, X.second);
+    // Cancel a buffered deletion, if any, otherwise buffer the insertion.
+    auto i = std::lower_bound(del.begin(), del.end(), X);
+    if (i != del.end() && *i == X) {
+        del.erase(i);
+    } else {
+        ins.insert(std::lower_bound(ins.begin(), ins.end(), X), X);
+        const EID T(X.second, X.first);
+        tins.insert(std::lower_bound(tins.begin(), tins.end(), T), T);
+    }
+    // Update counters.
+    dout[X.first]++;
+    din[X.second]++;
+    hash_edge(X, true);
+    // Merge the buffers if too large.
+    if (ins.size() + del.size() > threshold()) merge();
+}
+
+inline void SparseGraph::del_edge(const EID &X) {
+    TELEGRAPH_PROBE(DEL_EDGE);
+    if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);
+    // Cancel a buffered insertion, if any, otherwise buffer the deletion.
+    auto i = std::lower_bound(ins.begin(), ins.end(), X);
+    if (i != ins.end() && *i == X) {
+        ins.erase(i);
+        tins.erase(std::lower_bound(tins.begin(), tins.end(), EID(X.second, X.first)));
+    } else {
+        del.insert(std::lower_bound(del.begin(), del.end(), X), X);
+    }
+    // Update counters.
+    dout[X.first]--;
+    din[X.second]--;
+    hash_edge(X, false);
+    // Merge the buffers if too large.
+    if (ins.size() + del.size() > threshold()) merge();
+    // Delete associated label and attributes.
+    del_edge_metadata(X);
+}
+
+inline void SparseGraph::bulk_add_edges(const EID *first, const EID *last) {
+    check_edges(first, last);
+    // Apply pending mutations.
+    merge();
+    // Sort the sequence in row order, dropping duplicates and existing edges.
+    std::vector<EID> E(first, last);
+    std::sort(E.begin(), E.end());
+    E.erase(std::unique(E.begin(), E.end()), E.end());
+    E.erase(std::remove_if(E.begin(), E.end(), [&](const EID &e) { return has_stored_edge(e); }), E.end());
+    for (const EID &e : E) hash_edge(e, true);
+    // Merge the sequence as a single delta buffer.
+    ins = std::move(E);
+    A = merged();
+    ins.clear();
+    // Rebuild the transposed matrix and the degrees.
+    reindex();
+}
+
+inline void SparseGraph::bulk_del_edges(const EID *first, const EID *last) {
+    check_edges(first, last);
+    // Apply pending mutations.
+    merge();
+    // Sort the sequence in row order, dropping duplicates and missing edges.
+    std::vector<EID> E(first, last);
+    std::sort(E.begin(), E.end());
+    E.erase(std::unique(E.begin(), E.end()), E.end());
+    E.erase(std::remove_if(E.begin(), E.end(), [&](const EID &e) { return !has_stored_edge(e); }), E.end());
+    // Delete associated labels and attributes.
+    for (const EID &e : E) {
+        del_edge_metadata(e);
+        hash_edge(e, false);
+    }
+    // Merge the sequence as a single delta buffer.
+    del = std::move(E);
+    A = merged();
+    del.clear();
+    // Rebuild the transposed matrix and the degrees.
+    reindex();
+}
+
+inline void SparseGraph::compact_vertices(const VID *first, const VID *last) {
+    // Apply pending mutations.
+    merge();
+    // Build the compaction map.
+    std::vector<VID> remap = compaction_map(first, last, A.rows());
+    // Collect the remapped EIDs not incident to deleted vertices,
+    // the compaction map is monotonic so they are still sorted.
+    std::vector<EID> E;
+    E.reserve(A.nonZeros());
+    for (Eigen::Index i = 0; i < A.outerSize(); i++) {
+        if (remap[i] == NONE) continue;
+        for (SparseAdjacencyMatrix::InnerIterator it(A, i); it; ++it) {
+            if (remap[it.col()] != NONE) E.emplace_back(remap[i], remap[it.col()]);
+        }
+    }
+    // Rebuild the compressed matrix.
+    A = from_edges(E, A.rows() - (last - first));
+    // Recount degrees.
+    reindex();
+    // Remap labels and attributes.
+    remap_metadata(remap);
+}
+
+inline bool SparseGraph::next_child(const VID &X, std::size_t &i, VID &Y) const {
+    const auto *outer = A.outerIndexPtr();
+    const auto *inner = A.innerIndexPtr();
+    // Scan the stored row first, skipping buffered deletions.
+    const std::size_t k = outer[X + 1] - outer[X];
+    for (; i < k; i++) {
+        Y = inner[outer[X] + i];
+        if (del.empty() || !std::binary_search(del.begin(), del.end(), EID(X, Y))) {
+            i++;
+            return true;
+        }
+    }
+    // Then scan the buffered insertions of the row.
+    std::size_t j = std::lower_bound(ins.begin(), ins.end(), EID(X, 0)) - ins.begin() + (i - k);
+    if (j >= ins.size() || ins[j].first != X) return false;
+    Y = ins[j].second;
+    i++;
+    return true;
+}
+
+inline bool SparseGraph::next_parent(const VID &X, std::size_t &i, VID &Y) const {
+    const auto *outer = At.outerIndexPtr();
+    const auto *inner = At.innerIndexPtr();
+    // Scan the stored column first, skipping buffered deletions.
+    const std::size_t k = outer[X + 1] - outer[X];
+    for (; i < k; i++) {
+        Y = inner[outer[X] + i];
+        if (del.empty() || !std::binary_search(del.begin(), del.end(), EID(Y, X))) {
+            i++;
+            return true;
+        }
+    }
+    // Then scan the buffered insertions of the column.
+    std::size_t j = std::lower_bound(tins.begin(), tins.end(), EID(X, 0)) - tins.begin() + (i - k);
+    if (j >= tins.size() || tins[j].first != X) return false;
+    Y = tins[j].second;
+    i++;
+    return true;
+}
+
+void SparseGraph::print(std::ostream &out) const {
+    // Get current matrix size.
+    std::size_t n = A.rows();
+
+    // Print graph class.
+    out << "SparseGraph( ";
+
+    // Print vertex set.
+    out << "V = ( ";
+    // Iterate over vertices, skipping tombstones.
+    for (VID i = 0; i < n; i++) {
+        if (!is_tombstone(i)) out << i << ", ";
+    }
+    // Close vertex set.
+    out << " )";
+
+    // Print edge set.
+    out << ", E = ( ";
+    // Iterate over edges.
+    SparseAdjacencyMatrix B = merged();
+    for (Eigen::Index i = 0; i < B.outerSize(); i++) {
+        for (SparseAdjacencyMatrix::InnerIterator it(B, i); it; ++it) {
+            out << "(" << i << ", " << it.col() << "), ";
+        }
+    }
+    // Close edge set.
+    out << " )";
+
+    // Close graph class.
+    out << " )" << std::endl;
+}
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <any>
-#include <boost/bimap.hpp>
-#include <boost/bimap/support/lambda.hpp>
+#include <atomic>
 #include <boost/container_hash/hash.hpp>
+#include <limits>
 
 #include "interface_graph.ipp"
+#include "label_map.ipp"
+#include "property.ipp"
 
 //! Graph label.
 using GLB = std::string;
@@ -13,7 +15,9 @@ using GLB = std::string;
 using VLB = std::string;
 //! Edge label.
 class ELB : public std::string {
-    explicit ELB(const std::string &&other) : std::string(other) {}
+   public:
+    ELB() {}
+    explicit ELB(const std::string &other) : std::string(other) {}
 };
 //! Vertex labels set.
 using VLBs = std::set<VLB>;
@@ -24,17 +28,139 @@ class AbstractGraph : public IGraph {
    protected:
     //! Graph label, aka its name.
     GLB glb;
-    //! Bidirectional mapping for vertex ids and labels.
-    boost::bimap<VID, VLB> vlbs;
-    //! Bidirectional mapping for edge ids and labels.
-    boost::bimap<EID, ELB> elbs;
+    //! Bidirectional mapping for vertex ids and interned labels.
+    LabelMap<VID> vlbs;
+    //! Bidirectional mapping for edge ids and interned labels.
+    LabelMap<EID> elbs;
 
     //! Graph attributes.
     std::map<std::string, std::any> gattrs;
-    //! Vertices attributes.
-    std::map<VID, std::map<std::string, std::any>> vattrs;
-    //! Edges attributes.
-    std::map<EID, std::map<std::string, std::any>> eattrs;
+    //! Vertices attributes, one column per key.
+    VertexTable vattrs;
+    //! Edges attributes, one column per key.
+    EdgeTable eattrs;
+
+    //! Mapped vertex id of deleted vertices in a compaction map.
+    static constexpr VID NONE = std::numeric_limits<VID>::max();
+
+    //! Whether vertex deletions are deferred until compaction or not.
+    bool deferred;
+    //! Deleted vertices awaiting compaction, indexed by vertex id.
+    std::vector<bool> tomb;
+    //! Number of deleted vertices awaiting compaction.
+    std::size_t ntomb;
+
+    //! Sum of the mixed hashes of the vertex ids, valid if not stale.
+    mutable std::atomic<std::size_t> vsum;
+    //! Sum of the mixed hashes of the edge ids, valid if not stale.
+    mutable std::atomic<std::size_t> esum;
+    //! Whether the sums have to be recomputed, e.g. after the vertex ids are compacted.
+    //! Concurrent hashes of a const graph may recompute them at once, storing the same values.
+    mutable std::atomic<bool> stale;
+
+    /**
+     * @brief Mixed hash of an edge id.
+     *
+     * @param X Given edge id.
+     * @return std::size_t Mixed hash value.
+     */
+    static inline std::size_t mix(const EID &X);
+
+    /**
+     * @brief Update the structural hash after a vertex is added or deleted.
+     *
+     * @param X Given vertex id.
+     * @param add Whether the vertex was added or deleted.
+     */
+    inline void hash_vertex(const VID &X, bool add);
+
+    /**
+     * @brief Update the structural hash after an edge is added or deleted.
+     *
+     * @param X Given edge id.
+     * @param add Whether the edge was added or deleted.
+     */
+    inline void hash_edge(const EID &X, bool add);
+
+    /**
+     * @brief Check if a vertex has been deleted but not compacted yet.
+     *
+     * @param X Given vertex id.
+     * @return true If the vertex is a tombstone,
+     * @return false Otherwise.
+     */
+    inline bool is_tombstone(const VID &X) const;
+
+    /**
+     * @brief Detach a sorted range of vertices and mark them as tombstones, without compacting the vertex ids.
+     *
+     * The incident edges of the whole range are deleted with a single bulk call.
+     *
+     * @param first Pointer to the first vertex id.
+     * @param last Pointer past the last vertex id.
+     */
+    inline void tombstone(const VID *first, const VID *last);
+
+    /**
+     * @brief Build the compaction map for a sequence of deleted vertices.
+     *
+     * @param first First vertex pointer, *sorted* and *unique*.
+     * @param last Last vertex pointer.
+     * @param n Given number of allocated vertex ids.
+     * @return std::vector<VID> New vertex id of each vertex id, NONE if deleted.
+     */
+    static inline std::vector<VID> compaction_map(const VID *first, const VID *last, std::size_t n);
+
+    /**
+     * @brief Remap vertex and edge labels and attributes after a compaction.
+     *
+     * Labels and attributes of deleted vertices and of their edges are dropped.
+     *
+     * @param remap Given compaction map.
+     */
+    inline void remap_metadata(const std::vector<VID> &remap);
+
+    /**
+     * @brief Delete a sequence of vertices from the storage and compact the vertex ids.
+     *
+     * Implementations compact the storage in a single pass and remap the metadata.
+     *
+     * @param first First vertex pointer, *sorted*, *unique* and existing.
+     * @param last Last vertex pointer.
+     */
+    inline virtual void compact_vertices(const VID *first, const VID *last) = 0;
+
+    inline virtual void bulk_del_vertices(const VID *first, const VID *last) override;
+
+    inline virtual bool next_vertex(std::size_t &i, VID &Y) const override;
+
+    /**
+     * @brief Delete edge label and attributes after an edge deletion.
+     *
+     * @param X Deleted edge id.
+     */
+    inline void del_edge_metadata(const EID &X);
+
+    /**
+     * @brief Hash of the vertex and edge ids and of the labels.
+     *
+     * Vertex and edge ids are hashed as sums of mixed hashes, which are
+     * order-independent and maintained on each insertion and deletion, as
+     * well as the label maps, hence the hash takes constant time. The sums
+     * are recomputed in linear time only after the vertex ids are compacted.
+     *
+     * @return std::size_t Hash of the graph.
+     */
+    inline virtual std::size_t hash() const override;
+
+    /**
+     * @brief Swap the labels, attributes, tombstones and hash sums with another graph.
+     *
+     * Implementations swap their storage as well, for copy-and-swap assignment.
+     *
+     * @param other Given graph.
+     */
+    inline void swap(AbstractGraph &other);
 
    public:
     //! Default constructor for a new Abstract Graph object
@@ -109,6 +235,57 @@ class AbstractGraph : public IGraph {
      */
     inline void del_attr(const std::string &key);
 
+    /**
+     * @brief Check if there are no deleted vertices awaiting compaction.
+     *
+     * @return true If the graph is compact,
+     * @return false Otherwise.
+     */
+    inline bool is_compact() const;
+
+    /**
+     * @brief Check if the tombstone mode is enabled.
+     *
+     * @return true If vertex deletions are deferred,
+     * @return false Otherwise.
+     */
+    inline bool get_tombstone_mode() const;
+
+    /**
+     * @brief Enable or disable the tombstone mode.
+     *
+     * In tombstone mode, deleting a vertex detaches it and drops its metadata,
+     * but the vertex ids of the remaining vertices are left unchanged until
+     * compact() is called. Meanwhile, matrix representations keep an empty
+     * row and column for each tombstone. Disabling the mode compacts the graph.
+     *
+     * @param enable Given mode.
+     */
+    inline void set_tombstone_mode(bool enable);
+
+    /**
+     * @brief Compact the vertex ids, removing the tombstones in a single pass.
+     */
+    inline void compact();
+
+    /**
+     * @brief Memory used by the labels, the attributes and the tombstones.
+     *
+     * Implementations add their adjacency storage.
+     *
+     * @return MemoryUsage Memory usage, in bytes.
+     */
+    inline virtual MemoryUsage memory_usage() const override;
+
+    /**
+     * @brief Release the unused memory of the labels, the attributes and the tombstones.
+     *
+     * Edge attribute slots and label ids are renumbered densely, tombstones
+     * are kept until compaction. Implementations release the unused memory
+     * of their adjacency storage as well.
+     */
+    inline virtual void shrink_to_fit() override;
+
     /** \addtogroup vertices
      *  @{
      */
@@ -278,6 +455,47 @@ class AbstractGraph : public IGraph {
      */
     inline void del_attr(const VLB &X, const std::string &key);
 
+    /**
+     * @brief Get a typed handle to the vertex attribute given its key.
+     *
+     * The attribute column is created if it does not exist. Each key is bound
+     * to the type of its first use, the string-keyed accessors share the same columns.
+     *
+     * @tparam T Attribute value type, *default constructible*.
+     * @param key Given attribute key.
+     * @return VertexProperty<T> Vertex attribute handle.
+     * @throws std::bad_any_cast If the key is bound to a different type.
+     */
+    template <typename T>
+    inline VertexProperty<T> vertex_property(const std::string &key);
+
+    /**
+     * @brief Get a read-only typed handle to the vertex attribute given its key.
+     *
+     * @tparam T Attribute value type.
+     * @param key Given attribute key.
+     * @return ConstVertexProperty<T> Read-only vertex attribute handle.
+     * @throws std::invalid_argument If the key is not defined.
+     * @throws std::bad_any_cast If the key is bound to a different type.
+     */
+    template <typename T>
+    inline ConstVertexProperty<T> vertex_property(const std::string &key) const;
+
+    /**
+     * @brief Get the value type of the vertex attribute given its key.
+     *
+     * @param key Given attribute key.
+     * @return const std::type_info& Attribute value type, typeid(void) if the key is not defined.
+     */
+    inline const std::type_info &vertex_property_type(const std::string &key) const;
+
+    /**
+     * @brief Get the keys of the vertex attributes.
+     *
+     * @return std::vector<std::string> Attribute keys, in sorted order.
+     */
+    inline std::vector<std::string> vertex_property_keys() const;
+
     /**
      * @brief Whether a vertex exists or not.
      *
@@ -626,6 +844,47 @@ class AbstractGraph : public IGraph {
      */
     inline void del_attr(const VLB &X, const VLB &Y, const std::string &key);
 
+    /**
+     * @brief Get a typed handle to the edge attribute given its key.
+     *
+     * The attribute column is created if it does not exist. Each key is bound
+     * to the type of its first use, the string-keyed accessors share the same columns.
+     *
+     * @tparam T Attribute value type, *default constructible*.
+     * @param key Given attribute key.
+     * @return EdgeProperty<T> Edge attribute handle.
+     * @throws std::bad_any_cast If the key is bound to a different type.
+     */
+    template <typename T>
+    inline EdgeProperty<T> edge_property(const std::string &key);
+
+    /**
+     * @brief Get a read-only typed handle to the edge attribute given its key.
+     *
+     * @tparam T Attribute value type.
+     * @param key Given attribute key.
+     * @return ConstEdgeProperty<T> Read-only edge attribute handle.
+     * @throws std::invalid_argument If the key is not defined.
+     * @throws std::bad_any_cast If the key is bound to a different type.
+     */
+    template <typename T>
+    inline ConstEdgeProperty<T> edge_property(const std::string &key) const;
+
+    /**
+     * @brief Get the value type of the edge attribute given its key.
+     *
+     * @param key Given attribute key.
+     * @return const std::type_info& Attribute value type, typeid(void) if the key is not defined.
+     */
+    inline const std::type_info &edge_property_type(const std::string &key) const;
+
+    /**
+     * @brief Get the keys of the edge attributes.
+     *
+     * @return std::vector<std::string> Attribute keys, in sorted order.
+     */
+    inline std::vector<std::string> edge_property_keys() const;
+
     /**
      * @brief Whether an edge exists or not.
      *
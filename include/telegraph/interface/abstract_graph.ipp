@@ -3,7 +3,7 @@
 #include "abstract_graph.hpp"
 #include "exceptions.hpp"
 
-AbstractGraph::AbstractGraph() {}
+AbstractGraph::AbstractGraph() : deferred(false), ntomb(0), vsum(0), esum(0), stale(true) {}
 
 AbstractGraph::AbstractGraph(const AbstractGraph &other)
     : glb(other.glb),
@@ -11,10 +11,200 @@ AbstractGraph::AbstractGraph(const AbstractGraph &other)
       elbs(other.elbs),
       gattrs(other.gattrs),
       vattrs(other.vattrs),
-      eattrs(other.eattrs) {}
+      eattrs(other.eattrs),
+      deferred(other.deferred),
+      tomb(other.tomb),
+      ntomb(other.ntomb),
+      vsum(other.vsum.load()),
+      esum(other.esum.load()),
+      stale(other.stale.load()) {}
 
 inline AbstractGraph::~AbstractGraph() {}
 
+inline void AbstractGraph::swap(AbstractGraph &other) {
+    std::swap(glb, other.glb);
+    std::swap(vlbs, other.vlbs);
+    std::swap(elbs, other.elbs);
+    std::swap(gattrs, other.gattrs);
+    std::swap(vattrs, other.vattrs);
+    std::swap(eattrs, other.eattrs);
+    std::swap(deferred, other.deferred);
+    std::swap(tomb, other.tomb);
+    std::swap(ntomb, other.ntomb);
+    vsum = other.vsum.exchange(vsum);
+    esum = other.esum.exchange(esum);
+    stale = other.stale.exchange(stale);
+}
+
+inline bool AbstractGraph::is_tombstone(const VID &X) const { return ntomb > 0 && X < tomb.size() && tomb[X]; }
+
+inline void AbstractGraph::tombstone(const VID *first, const VID *last) {
+    // Collect the incident edges of the sorted range, an edge between two
+    // deleted vertices is collected once, as an out-edge of its source.
+    std::vector<EID> E;
+    for (const VID *X = first; X != last; X++) {
+        for (const VID &Y : Ch(*X)) E.emplace_back(*X, Y);
+        for (const VID &Y : Pa(*X)) {
+            if (!std::binary_search(first, last, Y)) E.emplace_back(Y, *X);
+        }
+    }
+    // Detach the range at once, dropping the associated edge labels and attributes.
+    del_edges(E.begin(), E.end());
+    for (const VID *X = first; X != last; X++) {
+        // Delete associated label and attributes.
+        vlbs.erase(*X);
+        vattrs.erase(*X);
+        hash_vertex(*X, false);
+        // Mark X as a tombstone.
+        if (*X >= tomb.size()) tomb.resize(*X + 1, false);
+        tomb[*X] = true;
+        ntomb++;
+    }
+}
+
+inline std::vector<VID> AbstractGraph::compaction_map(const VID *first, const VID *last, std::size_t n) {
+    std::vector<VID> out(n);
+    // Shift each vertex id by the number of deleted vertices before it.
+    VID k = 0;
+    for (VID X = 0; X < n; X++) {
+        if (first != last && *first == X) {
+            out[X] = NONE;
+            first++;
+        } else {
+            out[X] = k++;
+        }
+    }
+    return out;
+}
+
+inline void AbstractGraph::remap_metadata(const std::vector<VID> &remap) {
+    // Get the number of vertices after compaction.
+    std::size_t n = std::count_if(remap.begin(), remap.end(), [](const VID &X) { return X != NONE; });
+    // Rekey vertex and edge labels, labels of deleted vertices and of their edges are dropped.
+    vlbs.compact(remap, n);
+    elbs.compact(remap, n);
+    // Compact vertex attributes columns, moving the values in place.
+    vattrs.compact(remap, n);
+    // Rekey edge attributes slots, values are not moved.
+    eattrs.compact(remap, n);
+}
+
+inline void AbstractGraph::bulk_del_vertices(const VID *first, const VID *last) {
+    if (deferred) {
+        // Defer the compaction.
+        tombstone(first, last);
+    } else {
+        compact_vertices(first, last);
+        stale = true;
+    }
+}
+
+inline bool AbstractGraph::next_vertex(std::size_t &i, VID &Y) const {
+    // Skip tombstones, which still hold their vertex ids.
+    std::size_t n = order() + ntomb;
+    while (i < n && is_tombstone(i)) i++;
+    if (i >= n) return false;
+    Y = i++;
+    return true;
+}
+
+inline void AbstractGraph::del_edge_metadata(const EID &X) {
+    // Delete associated label.
+    elbs.erase(X);
+    // Delete associated attributes.
+    eattrs.erase(X);
+}
+
+inline std::size_t AbstractGraph::mix(const EID &X) {
+    std::size_t h = 0;
+    boost::hash_combine(h, X);
+    return mix_hash(h);
+}
+
+inline void AbstractGraph::hash_vertex(const VID &X, bool add) {
+    // Stale sums are recomputed from scratch anyway.
+    if (stale.load(std::memory_order_relaxed)) return;
+    // Mutations are not concurrent, hence a plain read and write.
+    const std::size_t h = mix_hash(X);
+    vsum.store(vsum.load(std::memory_order_relaxed) + (add ? h : -h), std::memory_order_relaxed);
+}
+
+inline void AbstractGraph::hash_edge(const EID &X, bool add) {
+    if (stale.load(std::memory_order_relaxed)) return;
+    const std::size_t h = mix(X);
+    esum.store(esum.load(std::memory_order_relaxed) + (add ? h : -h), std::memory_order_relaxed);
+}
+
+inline std::size_t AbstractGraph::hash() const {
+    TELEGRAPH_PROBE(HASH);
+    if (stale.load(std::memory_order_acquire)) {
+        // Recompute the sums once, they are maintained incrementally afterwards.
+        std::size_t v = 0, e = 0;
+        for (const VID &X : V()) v += mix_hash(X);
+        for (const EID &X : E()) e += mix(X);
+        vsum.store(v, std::memory_order_relaxed);
+        esum.store(e, std::memory_order_relaxed);
+        stale.store(false, std::memory_order_release);
+    }
+    // Initialize seed hash.
+    std::size_t seed = 0;
+    // Hash VIDs and EIDs.
+    boost::hash_combine(seed, vsum.load(std::memory_order_relaxed));
+    boost::hash_combine(seed, esum.load(std::memory_order_relaxed));
+    // Hash GLB.
+    if (has_label()) boost::hash_combine(seed, glb);
+    // Hash VLBs.
+    boost::hash_combine(seed, vlbs.hash());
+    // Hash ELBs.
+    boost::hash_combine(seed, elbs.hash());
+    // Return hash
+    return seed;
+}
+
+inline bool AbstractGraph::is_compact() const { return ntomb == 0; }
+
+inline bool AbstractGraph::get_tombstone_mode() const { return deferred; }
+
+inline void AbstractGraph::set_tombstone_mode(bool enable) {
+    deferred = enable;
+    if (!deferred) compact();
+}
+
+inline void AbstractGraph::compact() {
+    if (is_compact()) return;
+    // Collect the tombstones in order.
+    std::vector<VID> V;
+    V.reserve(ntomb);
+    for (VID X = 0; X < tomb.size(); X++) {
+        if (tomb[X]) V.push_back(X);
+    }
+    // Clear the tombstones, then compact the storage.
+    tomb.clear();
+    ntomb = 0;
+    compact_vertices(V.data(), V.data() + V.size());
+    stale = true;
+}
+
+inline MemoryUsage AbstractGraph::memory_usage() const {
+    MemoryUsage out;
+    out.vertex_labels = vlbs.heap_size();
+    out.edge_labels = elbs.heap_size();
+    out.graph_attributes = heap_size(glb) + heap_size(gattrs);
+    out.vertex_attributes = vattrs.heap_size();
+    out.edge_attributes = eattrs.heap_size();
+    out.other = heap_size(tomb);
+    out.slack = vlbs.heap_slack() + elbs.heap_slack() + vattrs.heap_slack() + eattrs.heap_slack() + heap_slack(tomb);
+    return out;
+}
+
+inline void AbstractGraph::shrink_to_fit() {
+    vlbs.shrink_to_fit();
+    elbs.shrink_to_fit();
+    vattrs.shrink_to_fit();
+    eattrs.shrink_to_fit();
+    tomb.shrink_to_fit();
+}
+
 inline bool AbstractGraph::has_label() const { return !glb.empty(); }
 
 inline GLB AbstractGraph::get_label() const {
@@ -43,7 +233,7 @@ inline T AbstractGraph::get_attr(const std::string &key) const {
 
 template <typename T>
 inline void AbstractGraph::set_attr(const std::string &key, const T &value) {
-    gattrs[key] = std::make_any(value);
+    gattrs[key] = std::make_any<T>(value);
 }
 
 inline void AbstractGraph::del_attr(const std::string &key) {
@@ -53,94 +243,111 @@ inline void AbstractGraph::del_attr(const std::string &key) {
 }
 
 inline VID AbstractGraph::get_vid(const VLB &X) const {
-    auto i = vlbs.right.find(X);
-    if (i == vlbs.right.end()) throw NO_LABEL(X);
-    return i->second;
+    TELEGRAPH_PROBE(GET_VID);
+    std::size_t i = vlbs.find(std::string_view(X));
+    if (i == vlbs.npos) throw NO_LABEL(X);
+    return vlbs.key(i);
 }
 
 inline bool AbstractGraph::has_label(const VID &X) const {
     if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
-    return vlbs.left.find(X) != vlbs.left.end();       // Check if X has a defined label.
+    return vlbs.find(X) != vlbs.npos;          // Check if X has a defined label.
 }
 
 inline VLB AbstractGraph::get_label(const VID &X) const {
+    TELEGRAPH_PROBE(GET_VERTEX_LABEL);
     if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
-    auto i = vlbs.left.find(X);
-    if (i == vlbs.left.end()) throw NO_LABEL(X);  // Check if X has a defined label.
-    return i->second;
+    std::size_t i = vlbs.find(X);
+    if (i == vlbs.npos) throw NO_LABEL(X);  // Check if X has a defined label.
+    return VLB(vlbs.label(i));
 }
 
 inline void AbstractGraph::set_label(const VID &X, const VLB &label) {
-    if (label.empty()) throw INVALID_LABEL;            // Check if label is valid.
+    if (label.empty()) throw INVALID_LABEL;    // Check if label is valid.
     if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
     // Check if the label as already been defined.
-    auto i = vlbs.right.find(label);
-    if (i != vlbs.right.end()) {
+    std::size_t i = vlbs.find(std::string_view(label));
+    if (i != vlbs.npos) {
         // It has been defined for a different vertex.
-        if (i->second != X) throw DUPLICATED_LABEL(label);
+        if (vlbs.key(i) != X) throw DUPLICATED_LABEL(label);
     } else {
-        auto j = vlbs.left.find(X);
-        if (j == vlbs.left.end()) {
-            vlbs.left.insert({X, label});  // Insert label if none found.
-        } else {
-            vlbs.left.replace(j, {X, label});  // Replace label if one found.
-        }
+        vlbs.set(X, label);  // Insert or replace the label.
     }
 }
 
 inline void AbstractGraph::set_label(const VLB &X, const VLB &label) { set_label(get_vid(X), label); }
 
 inline void AbstractGraph::del_label(const VID &X) {
-    if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
-    auto i = vlbs.left.find(X);
-    if (i == vlbs.left.end()) throw NO_LABEL(X);  // Check if X has a valid label.
-    vlbs.left.erase(i);
+    if (!has_vertex(X)) throw NOT_DEFINED(X);          // Check if X is a valid vertex.
+    if (vlbs.find(X) == vlbs.npos) throw NO_LABEL(X);  // Check if X has a valid label.
+    vlbs.erase(X);
 }
 
 inline void AbstractGraph::del_label(const VLB &X) { del_label(get_vid(X)); }
 
 inline bool AbstractGraph::has_attr(const VID &X, const std::string &key) const {
     if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
-    auto i = vattrs.find(X);
-    return i != vattrs.end() && i->second.find(key) != i->second.end();
+    const IColumn *c = vattrs.find(key);
+    return c != nullptr && c->has(X);
 }
 
 inline bool AbstractGraph::has_attr(const VLB &X, const std::string &key) const { return has_attr(get_vid(X), key); }
 
 template <typename T>
 inline T AbstractGraph::get_attr(const VID &X, const std::string &key) const {
+    TELEGRAPH_PROBE(GET_VERTEX_ATTR);
     if (!has_attr(X, key)) throw NO_KEY(key);  // Check if key is valid.
-    return std::any_cast<T>(vattrs.find(X)->second.find(key)->second);
+    return vattrs.column<T>(key).get(X);
 }
 
 template <typename T>
 inline T AbstractGraph::get_attr(const VLB &X, const std::string &key) const {
+    TELEGRAPH_PROBE(GET_VERTEX_ATTR);
     return get_attr<T>(get_vid(X), key);
 }
 
 template <typename T>
 inline void AbstractGraph::set_attr(const VID &X, const std::string &key, const T &value) {
+    TELEGRAPH_PROBE(SET_VERTEX_ATTR);
     if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
-    vattrs[X][key] = std::make_any(value);
+    vattrs.column<T>(key).at(X) = value;
 }
 
 template <typename T>
 inline void AbstractGraph::set_attr(const VLB &X, const std::string &key, const T &value) {
+    TELEGRAPH_PROBE(SET_VERTEX_ATTR);
     set_attr<T>(get_vid(X), key, value);
 }
 
 inline void AbstractGraph::del_attr(const VID &X, const std::string &key) {
     if (!has_attr(X, key)) throw NO_KEY(key);  // Check if key is valid.
-    vattrs[X].erase(key);
+    vattrs.erase(key, X);
 }
 
 inline void AbstractGraph::del_attr(const VLB &X, const std::string &key) { del_attr(get_vid(X), key); }
 
-inline bool AbstractGraph::has_vertex(const VLB &X) const { return vlbs.right.find(X) != vlbs.right.end(); }
+template <typename T>
+inline VertexProperty<T> AbstractGraph::vertex_property(const std::string &key) {
+    return VertexProperty<T>(this, &vattrs.column<T>(key));
+}
+
+template <typename T>
+inline ConstVertexProperty<T> AbstractGraph::vertex_property(const std::string &key) const {
+    return ConstVertexProperty<T>(&vattrs.column<T>(key));
+}
+
+inline const std::type_info &AbstractGraph::vertex_property_type(const std::string &key) const {
+    const IColumn *c = vattrs.find(key);
+    return c == nullptr ? typeid(void) : c->type();
+}
+
+inline std::vector<std::string> AbstractGraph::vertex_property_keys() const { return vattrs.keys(); }
+
+inline bool AbstractGraph::has_vertex(const VLB &X) const { return vlbs.find(std::string_view(X)) != vlbs.npos; }
 
 inline VID AbstractGraph::add_vertex(const VLB &label) {
-    if (label.empty()) throw INVALID_LABEL;                                         // Check if label is valid.
-    if (vlbs.right.find(label) != vlbs.right.end()) throw DUPLICATED_LABEL(label);  // Check if label is valid.
+    if (label.empty()) throw INVALID_LABEL;                // Check if label is valid.
+    if (has_vertex(label)) throw DUPLICATED_LABEL(label);  // Check if label is valid.
     VID X = add_vertex();
     set_label(X, label);
     return X;
@@ -149,14 +356,15 @@ inline VID AbstractGraph::add_vertex(const VLB &label) {
 inline void AbstractGraph::del_vertex(const VLB &X) { del_vertex(get_vid(X)); }
 
 inline EID AbstractGraph::get_eid(const ELB &X) const {
-    auto i = elbs.right.find(X);
-    if (i == elbs.right.end()) throw NO_LABEL(X, "\b\b");  // Use backspaces to patch NO_LABEL argument.
-    return i->second;
+    TELEGRAPH_PROBE(GET_EID);
+    std::size_t i = elbs.find(std::string_view(X));
+    if (i == elbs.npos) throw NO_LABEL(X, "\b\b");  // Use backspaces to patch NO_LABEL argument.
+    return elbs.key(i);
 }
 
 inline bool AbstractGraph::has_label(const EID &X) const {
     if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);  // Check if X is a valid edge.
-    return elbs.left.find(X) != elbs.left.end();
+    return elbs.find(X) != elbs.npos;
 }
 
 inline bool AbstractGraph::has_label(const VID &X, const VID &Y) const { return has_label(EID(X, Y)); }
@@ -166,30 +374,29 @@ inline bool AbstractGraph::has_label(const VLB &X, const VLB &Y) const {
 }
 
 inline ELB AbstractGraph::get_label(const EID &X) const {
-    auto i = elbs.left.find(X);
-    if (i == elbs.left.end()) throw NOT_DEFINED(X.first, X.second);  // Check if X is a valid edge.
-    return i->second;
+    TELEGRAPH_PROBE(GET_EDGE_LABEL);
+    std::size_t i = elbs.find(X);
+    if (i == elbs.npos) throw NOT_DEFINED(X.first, X.second);  // Check if X is a valid edge.
+    return ELB(std::string(elbs.label(i)));
 }
 
 inline ELB AbstractGraph::get_label(const VID &X, const VID &Y) const { return get_label(EID(X, Y)); }
 
-inline ELB AbstractGraph::get_label(const VLB &X, const VLB &Y) const { return get_label(get_vid(X), get_vid(Y)); }
+inline ELB AbstractGraph::get_label(const VLB &X, const VLB &Y) const {
+    TELEGRAPH_PROBE(GET_EDGE_LABEL);
+    return get_label(get_vid(X), get_vid(Y));
+}
 
 inline void AbstractGraph::set_label(const EID &X, const ELB &label) {
-    if (label.empty()) throw INVALID_LABEL;                          // Check if label is valid.
+    if (label.empty()) throw INVALID_LABEL;                  // Check if label is valid.
     if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);  // Check if X is a valid edge.
     // Check if the label as already been defined.
-    auto i = elbs.right.find(label);
-    if (i != elbs.right.end()) {
+    std::size_t i = elbs.find(std::string_view(label));
+    if (i != elbs.npos) {
         // It has been defined for a different edge.
-        if (i->second != X) throw DUPLICATED_LABEL(label);
+        if (elbs.key(i) != X) throw DUPLICATED_LABEL(label);
     } else {
-        auto j = elbs.left.find(X);
-        if (j == elbs.left.end()) {
-            elbs.left.insert({X, label});  // Insert label if none found.
-        } else {
-            elbs.left.replace(j, {X, label});  // Replace label if one found.
-        }
+        elbs.set(X, label);  // Insert or replace the label.
     }
 }
 
@@ -202,10 +409,9 @@ inline void AbstractGraph::set_label(const VLB &X, const VLB &Y, const ELB &labe
 }
 
 inline void AbstractGraph::del_label(const EID &X) {
-    if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);  // Check if X is a valid edge.
-    auto i = elbs.left.find(X);
-    if (i == elbs.left.end()) throw NO_LABEL(X.first, X.second);  // Check if X is a valid edge.
-    elbs.left.erase(i);
+    if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);            // Check if X is a valid edge.
+    if (elbs.find(X) == elbs.npos) throw NO_LABEL(X.first, X.second);  // Check if X is a valid edge.
+    elbs.erase(X);
 }
 
 inline void AbstractGraph::del_label(const ELB &X) { del_label(get_eid(X)); }
@@ -216,8 +422,8 @@ inline void AbstractGraph::del_label(const VLB &X, const VLB &Y) { del_label(get
 
 inline bool AbstractGraph::has_attr(const EID &X, const std::string &key) const {
     if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);  // Check if X is a valid edge.
-    auto i = eattrs.find(X);
-    return i != eattrs.end() && i->second.find(key) != i->second.end();
+    const IColumn *c = eattrs.find(key);
+    return c != nullptr && c->has(eattrs.find_slot(X));
 }
 
 inline bool AbstractGraph::has_attr(const ELB &X, const std::string &key) const { return has_attr(get_eid(X), key); }
@@ -232,12 +438,14 @@ inline bool AbstractGraph::has_attr(const VLB &X, const VLB &Y, const std::strin
 
 template <typename T>
 inline T AbstractGraph::get_attr(const EID &X, const std::string &key) const {
+    TELEGRAPH_PROBE(GET_EDGE_ATTR);
     if (!has_attr(X, key)) throw NO_KEY(key);  // Check if key is valid.
-    return std::any_cast<T>(eattrs.find(X)->second.find(key)->second);
+    return eattrs.column<T>(key).get(eattrs.find_slot(X));
 }
 
 template <typename T>
 inline T AbstractGraph::get_attr(const ELB &X, const std::string &key) const {
+    TELEGRAPH_PROBE(GET_EDGE_ATTR);
     return get_attr<T>(get_eid(X), key);
 }
 
@@ -248,17 +456,20 @@ inline T AbstractGraph::get_attr(const VID &X, const VID &Y, const std::string &
 
 template <typename T>
 inline T AbstractGraph::get_attr(const VLB &X, const VLB &Y, const std::string &key) const {
+    TELEGRAPH_PROBE(GET_EDGE_ATTR);
     return get_attr<T>(get_vid(X), get_vid(Y), key);
 }
 
 template <typename T>
 inline void AbstractGraph::set_attr(const EID &X, const std::string &key, const T &value) {
+    TELEGRAPH_PROBE(SET_EDGE_ATTR);
     if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);  // Check if X is a valid vertex.
-    eattrs[X][key] = std::make_any(value);
+    eattrs.column<T>(key).at(eattrs.slot(X)) = value;
 }
 
 template <typename T>
 inline void AbstractGraph::set_attr(const ELB &X, const std::string &key, const T &value) {
+    TELEGRAPH_PROBE(SET_EDGE_ATTR);
     set_attr<T>(get_eid(X), key, value);
 }
 
@@ -269,12 +480,13 @@ inline void AbstractGraph::set_attr(const VID &X, const VID &Y, const std::strin
 
 template <typename T>
 inline void AbstractGraph::set_attr(const VLB &X, const VLB &Y, const std::string &key, const T &value) {
+    TELEGRAPH_PROBE(SET_EDGE_ATTR);
     set_attr<T>(get_vid(X), get_vid(Y), key, value);
 }
 
 inline void AbstractGraph::del_attr(const EID &X, const std::string &key) {
     if (!has_attr(X, key)) throw NO_KEY(key);  // Check if key is valid.
-    eattrs[X].erase(key);
+    eattrs.erase(key, eattrs.find_slot(X));
 }
 
 inline void AbstractGraph::del_attr(const ELB &X, const std::string &key) { del_attr(get_eid(X), key); }
@@ -285,6 +497,23 @@ inline void AbstractGraph::del_attr(const VLB &X, const VLB &Y, const std::strin
     del_attr(get_vid(X), get_vid(Y), key);
 }
 
+template <typename T>
+inline EdgeProperty<T> AbstractGraph::edge_property(const std::string &key) {
+    return EdgeProperty<T>(this, &eattrs, &eattrs.column<T>(key));
+}
+
+template <typename T>
+inline ConstEdgeProperty<T> AbstractGraph::edge_property(const std::string &key) const {
+    return ConstEdgeProperty<T>(&eattrs, &eattrs.column<T>(key));
+}
+
+inline const std::type_info &AbstractGraph::edge_property_type(const std::string &key) const {
+    const IColumn *c = eattrs.find(key);
+    return c == nullptr ? typeid(void) : c->type();
+}
+
+inline std::vector<std::string> AbstractGraph::edge_property_keys() const { return eattrs.keys(); }
+
 inline bool AbstractGraph::has_edge(const ELB &X) const { return has_edge(get_eid(X)); }
 
 inline bool AbstractGraph::has_edge(const VID &X, const VID &Y) const { return has_edge(EID(X, Y)); }
@@ -58,4 +58,13 @@ class NO_LABEL : public std::invalid_argument {
 
 #define INVALID_LABEL std::invalid_argument("Label cannot be empty string.")
 #define DUPLICATED_LABEL(X) std::invalid_argument("Label '" + std::to_string(X) + "' already defined.")
+#define UNQUOTED_LABEL(X) std::invalid_argument("Label '" + std::to_string(X) + "' cannot be written as a token.")
 #define NO_KEY(X) std::invalid_argument("Key " + std::to_string(X) + " is not defined.")
+#define NOT_ACYCLIC std::invalid_argument("Graph is not acyclic.")
+#define NEGATIVE_WEIGHT(X, Y) \
+    std::invalid_argument("Edge (" + std::to_string(X) + ", " + std::to_string(Y) + ") has a negative weight.")
+#define READ_ONLY std::logic_error("Graph is read-only.")
+#define IO_ERROR(X) std::runtime_error("File '" + std::to_string(X) + "' cannot be accessed.")
+#define INVALID_FILE(X) std::runtime_error("File '" + std::to_string(X) + "' is not a valid graph file.")
+#define PARSE_ERROR(X, Y) \
+    std::runtime_error("File '" + std::to_string(X) + "' is malformed at byte " + std::to_string(Y) + ".")
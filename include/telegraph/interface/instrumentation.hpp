@@ -0,0 +1,201 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * @brief Instrumented library calls.
+ */
+enum class Probe : std::size_t {
+    ADD_VERTEX,
+    DEL_VERTEX,
+    ADD_EDGE,
+    DEL_EDGE,
+    HAS_EDGE,
+    TO_ADJACENCY_LIST,
+    TO_ADJACENCY_MATRIX,
+    TO_SPARSE_ADJACENCY_MATRIX,
+    HASH,
+    GET_VID,
+    GET_EID,
+    GET_VERTEX_LABEL,
+    GET_EDGE_LABEL,
+    GET_VERTEX_ATTR,
+    GET_EDGE_ATTR,
+    SET_VERTEX_ATTR,
+    SET_EDGE_ATTR,
+    //! Number of probes, not a probe.
+    COUNT
+};
+
+//! Number of probes.
+static constexpr std::size_t PROBES = static_cast<std::size_t>(Probe::COUNT);
+//! One call out of PROBE_SAMPLING is timed, every call is counted.
+static constexpr std::uint64_t PROBE_SAMPLING = 16;
+
+#ifdef TELEGRAPH_INSTRUMENTATION
+//! Whether the library calls are instrumented.
+static constexpr bool INSTRUMENTED = true;
+//! Count and time the enclosing library call, if it is not nested in another one.
+#define TELEGRAPH_PROBE(P) const ::ProbeScope probe_scope(::Probe::P)
+#else
+//! Whether the library calls are instrumented.
+static constexpr bool INSTRUMENTED = false;
+//! Compiled out, define TELEGRAPH_INSTRUMENTATION to count and time the library calls.
+#define TELEGRAPH_PROBE(P)
+#endif
+
+/**
+ * @brief Name of a probe, as written in JSON.
+ *
+ * @param p Given probe.
+ * @return const char* Lowercase probe name.
+ */
+inline const char *probe_name(Probe p);
+
+/**
+ * @brief Aggregated statistics of a probe.
+ */
+struct ProbeStats {
+    //! Number of calls.
+    std::uint64_t calls = 0;
+    //! Total time spent in the calls, in nanoseconds, extrapolated from the timed calls.
+    std::uint64_t nanoseconds = 0;
+};
+
+/**
+ * @brief Statistics of every probe, summed over all threads.
+ */
+struct InstrumentationSnapshot {
+    //! Statistics indexed by probe.
+    std::array<ProbeStats, PROBES> probes;
+
+    /**
+     * @brief Statistics of a given probe.
+     *
+     * @param p Given probe.
+     * @return const ProbeStats& Probe statistics.
+     */
+    inline const ProbeStats &operator[](Probe p) const;
+
+    /**
+     * @brief Export the statistics as a JSON object.
+     *
+     * @return std::string JSON object, mapping each probe name to its calls and nanoseconds.
+     */
+    inline std::string json() const;
+};
+
+/**
+ * @brief Per-thread probe counters, padded to their own cache lines.
+ *
+ * Counters are written by their owner thread only, with relaxed loads and
+ * stores instead of atomic read-modify-write operations, and read by any
+ * thread when taking a snapshot.
+ */
+struct alignas(64) ProbeCounters {
+    //! Number of calls, indexed by probe.
+    std::array<std::atomic<std::uint64_t>, PROBES> calls{};
+    //! Number of timed calls, indexed by probe.
+    std::array<std::atomic<std::uint64_t>, PROBES> timed{};
+    //! Number of elapsed ticks of the timed calls, indexed by probe.
+    std::array<std::atomic<std::uint64_t>, PROBES> ticks{};
+    //! Number of open probe scopes of the owner thread.
+    std::size_t depth = 0;
+};
+
+/**
+ * @brief Registry of the per-thread probe counters.
+ *
+ * Counters are registered on the first instrumented call of each thread and
+ * kept after the thread exits, so that no call is lost.
+ */
+class ProbeRegistry {
+   protected:
+    //! Guard of the registered counters.
+    std::mutex mutex;
+    //! Registered counters.
+    std::vector<std::unique_ptr<ProbeCounters>> counters;
+    //! Ticks at construction, for the calibration of the tick period.
+    std::uint64_t tick0;
+    //! Time at construction, for the calibration of the tick period.
+    std::chrono::steady_clock::time_point time0;
+
+    //! Construct the registry.
+    inline ProbeRegistry();
+
+    //! Nanoseconds per tick, calibrated against the steady clock.
+    inline double tick_period();
+
+   public:
+    //! Process-wide registry.
+    static inline ProbeRegistry &instance();
+
+    //! Counters of the calling thread, registered on first use.
+    static inline ProbeCounters &local();
+
+    //! Current tick count, from the time stamp counter if available.
+    static inline std::uint64_t now();
+
+    //! Sum the counters of all threads.
+    inline InstrumentationSnapshot snapshot();
+
+    //! Reset the counters of all threads, not synchronized with concurrent calls.
+    inline void reset();
+};
+
+/**
+ * @brief Scoped probe, counting and timing the calls of its enclosing function.
+ *
+ * Only the outermost scope of a thread is recorded, hence a call made by
+ * another instrumented call, e.g. has_edge by add_edge, is accounted to the
+ * calling one. Reading the clock costs more than most instrumented calls,
+ * hence only one call out of PROBE_SAMPLING is timed.
+ */
+class ProbeScope {
+   protected:
+    //! Counters of the calling thread.
+    ProbeCounters &c;
+    //! Probe index.
+    std::size_t i;
+    //! Ticks at construction, zero if nested or not timed.
+    std::uint64_t start;
+
+   public:
+    /**
+     * @brief Open a probe scope.
+     *
+     * @param p Given probe.
+     */
+    inline explicit ProbeScope(Probe p);
+
+    //! Close the probe scope, recording the call if outermost.
+    inline ~ProbeScope();
+
+    ProbeScope(const ProbeScope &) = delete;
+    ProbeScope &operator=(const ProbeScope &) = delete;
+};
+
+/**
+ * @brief Take a snapshot of the probe statistics.
+ *
+ * Statistics are all zero unless TELEGRAPH_INSTRUMENTATION is defined.
+ *
+ * @return InstrumentationSnapshot Statistics summed over all threads.
+ */
+inline InstrumentationSnapshot instrumentation_snapshot();
+
+/**
+ * @brief Reset the probe statistics of all threads.
+ */
+inline void reset_instrumentation();
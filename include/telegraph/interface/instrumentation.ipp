@@ -0,0 +1,133 @@
+#pragma once
+
+#include "instrumentation.hpp"
+
+inline const char *probe_name(Probe p) {
+    static constexpr const char *names[PROBES] = {"add_vertex",
+                                                  "del_vertex",
+                                                  "add_edge",
+                                                  "del_edge",
+                                                  "has_edge",
+                                                  "to_adjacency_list",
+                                                  "to_adjacency_matrix",
+                                                  "to_sparse_adjacency_matrix",
+                                                  "hash",
+                                                  "get_vid",
+                                                  "get_eid",
+                                                  "get_vertex_label",
+                                                  "get_edge_label",
+                                                  "get_vertex_attr",
+                                                  "get_edge_attr",
+                                                  "set_vertex_attr",
+                                                  "set_edge_attr"};
+    return names[static_cast<std::size_t>(p)];
+}
+
+inline const ProbeStats &InstrumentationSnapshot::operator[](Probe p) const {
+    return probes[static_cast<std::size_t>(p)];
+}
+
+inline std::string InstrumentationSnapshot::json() const {
+    std::string out = "{";
+    for (std::size_t i = 0; i < PROBES; i++) {
+        if (i > 0) out += ", ";
+        out += "\"";
+        out += probe_name(static_cast<Probe>(i));
+        out += "\": {\"calls\": " + std::to_string(probes[i].calls) +
+               ", \"nanoseconds\": " + std::to_string(probes[i].nanoseconds) + "}";
+    }
+    return out + "}";
+}
+
+inline ProbeRegistry::ProbeRegistry() : tick0(now()), time0(std::chrono::steady_clock::now()) {}
+
+inline double ProbeRegistry::tick_period() {
+#if defined(__x86_64__) || defined(__i386__)
+    // Wait for a measurable interval since construction.
+    auto time = std::chrono::steady_clock::now();
+    while (time - time0 < std::chrono::milliseconds(10)) time = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(time - time0).count();
+    return ns / static_cast<double>(now() - tick0);
+#else
+    return 1;
+#endif
+}
+
+inline ProbeRegistry &ProbeRegistry::instance() {
+    static ProbeRegistry registry;
+    return registry;
+}
+
+inline ProbeCounters &ProbeRegistry::local() {
+    thread_local ProbeCounters *c = [] {
+        ProbeRegistry &r = instance();
+        const std::lock_guard<std::mutex> lock(r.mutex);
+        r.counters.push_back(std::make_unique<ProbeCounters>());
+        return r.counters.back().get();
+    }();
+    return *c;
+}
+
+inline std::uint64_t ProbeRegistry::now() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+inline InstrumentationSnapshot ProbeRegistry::snapshot() {
+    InstrumentationSnapshot out;
+    std::array<std::uint64_t, PROBES> timed{}, ticks{};
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        for (const auto &c : counters) {
+            for (std::size_t i = 0; i < PROBES; i++) {
+                out.probes[i].calls += c->calls[i].load(std::memory_order_relaxed);
+                timed[i] += c->timed[i].load(std::memory_order_relaxed);
+                ticks[i] += c->ticks[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+    // Calibrate only if anything was timed.
+    bool any = false;
+    for (std::size_t i = 0; i < PROBES; i++) any = any || timed[i] > 0;
+    const double period = any ? tick_period() : 0;
+    // Extrapolate the timed calls to all the calls.
+    for (std::size_t i = 0; i < PROBES; i++) {
+        if (timed[i] == 0) continue;
+        out.probes[i].nanoseconds = ticks[i] * period * out.probes[i].calls / timed[i];
+    }
+    return out;
+}
+
+inline void ProbeRegistry::reset() {
+    const std::lock_guard<std::mutex> lock(mutex);
+    for (const auto &c : counters) {
+        for (std::size_t i = 0; i < PROBES; i++) {
+            c->calls[i].store(0, std::memory_order_relaxed);
+            c->timed[i].store(0, std::memory_order_relaxed);
+            c->ticks[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+inline ProbeScope::ProbeScope(Probe p) : c(ProbeRegistry::local()), i(static_cast<std::size_t>(p)), start(0) {
+    // Time the outermost calls, one out of PROBE_SAMPLING.
+    if (c.depth++ == 0 && c.calls[i].load(std::memory_order_relaxed) % PROBE_SAMPLING == 0) start = ProbeRegistry::now();
+}
+
+inline ProbeScope::~ProbeScope() {
+    if (--c.depth != 0) return;
+    // Single writer, plain loads and stores are enough.
+    c.calls[i].store(c.calls[i].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (start == 0) return;
+    const std::uint64_t elapsed = ProbeRegistry::now() - start;
+    c.timed[i].store(c.timed[i].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    c.ticks[i].store(c.ticks[i].load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+}
+
+inline InstrumentationSnapshot instrumentation_snapshot() { return ProbeRegistry::instance().snapshot(); }
+
+inline void reset_instrumentation() { ProbeRegistry::instance().reset(); }
@@ -1,15 +1,31 @@
 #pragma once
 
 #include <Eigen/Eigen>
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <iterator>
 #include <map>
 #include <set>
 #include <utility>
+#include <vector>
+
+#include "instrumentation.ipp"
+#include "memory_usage.ipp"
 
 #define require_iter_value_type(I, T) typename std::enable_if<std::is_same<typename std::iterator_traits<I>::value_type, T>::value, int>::type
 
+/**
+ * @brief Whether an iterator is known to point to contiguous memory.
+ *
+ * @tparam I Iterator typename.
+ */
+template <typename I>
+struct is_contiguous_iterator
+    : std::disjunction<std::is_pointer<I>,
+                       std::is_same<I, typename std::vector<typename std::iterator_traits<I>::value_type>::iterator>,
+                       std::is_same<I, typename std::vector<typename std::iterator_traits<I>::value_type>::const_iterator>> {};
+
 //! Vertex identifier.
 using VID = uintmax_t;
 //! Edge identifier.
@@ -25,8 +41,52 @@ using AdjacencyMatrix = Eigen::Matrix<int8_t, Eigen::Dynamic, Eigen::Dynamic, Ei
 //! Sparse adjacency matrix.
 using SparseAdjacencyMatrix = Eigen::SparseMatrix<int8_t, Eigen::RowMajor>;
 
+/**
+ * @brief Mix the bits of a hash value with the SplitMix64 finalizer.
+ *
+ * Sums of mixed hash values are order-independent hashes of multisets,
+ * which do not collide trivially as sums of plain integers do.
+ *
+ * @param h Given hash value.
+ * @return std::size_t Mixed hash value.
+ */
+inline std::size_t mix_hash(std::size_t h);
+
+/**
+ * @brief Lightweight range over a pair of iterators.
+ *
+ * @tparam I Iterator typename.
+ */
+template <typename I>
+class Range {
+   protected:
+    //! First iterator.
+    I first;
+    //! Last iterator.
+    I last;
+
+   public:
+    /**
+     * @brief Construct a new Range object from a pair of iterators.
+     *
+     * @param first First iterator.
+     * @param last Last iterator.
+     */
+    Range(const I &first, const I &last) : first(first), last(last) {}
+
+    //! First iterator.
+    inline I begin() const { return first; }
+
+    //! Last iterator.
+    inline I end() const { return last; }
+};
+
 class IGraph {
    public:
+    class VertexIterator;
+    class EdgeIterator;
+    class AdjacencyIterator;
+
     //! Destroy the IGraph object.
     inline virtual ~IGraph();
 
@@ -101,6 +161,71 @@ class IGraph {
      */
     inline virtual bool is_complete() const;
 
+    /**
+     * @brief Memory used by the graph, by component.
+     *
+     * Sizes are computed from the container capacities in linear time in the
+     * number of attribute columns and of adjacency rows, without allocating.
+     *
+     * @return MemoryUsage Memory usage, in bytes.
+     */
+    inline virtual MemoryUsage memory_usage() const = 0;
+
+    /**
+     * @brief Release the allocated but unused memory of the graph.
+     *
+     * Vertex and edge ids, labels and attributes are left unchanged, while
+     * the storage is reallocated to its exact size, hence iterators and
+     * references to attribute values are invalidated.
+     */
+    inline virtual void shrink_to_fit() = 0;
+
+    /**
+     * @brief The vertex set of the graph.
+     *
+     * The range walks the native storage lazily, without allocating.
+     *
+     * @return Range<VertexIterator> Range over the vertex ids.
+     */
+    inline Range<VertexIterator> V() const;
+
+    /**
+     * @brief The edge set of the graph.
+     *
+     * The range walks the native storage lazily, without allocating.
+     *
+     * @return Range<EdgeIterator> Range over the edge ids.
+     */
+    inline Range<EdgeIterator> E() const;
+
+    /**
+     * @brief The neighbors of a vertex, i.e. the union of its parents and children.
+     *
+     * @param X Given vertex id.
+     * @return Range<AdjacencyIterator> Range over the neighbors vertex ids.
+     */
+    inline Range<AdjacencyIterator> Ne(const VID &X) const;
+
+    /**
+     * @brief The parents of a vertex, i.e. the sources of its incoming edges.
+     *
+     * On DenseGraph, the column of the vertex is scanned a bit per row, hence
+     * iterating over the parents takes O(n) time, unlike the children, whose
+     * scan skips zero words.
+     *
+     * @param X Given vertex id.
+     * @return Range<AdjacencyIterator> Range over the parents vertex ids.
+     */
+    inline Range<AdjacencyIterator> Pa(const VID &X) const;
+
+    /**
+     * @brief The children of a vertex, i.e. the targets of its outgoing edges.
+     *
+     * @param X Given vertex id.
+     * @return Range<AdjacencyIterator> Range over the children vertex ids.
+     */
+    inline Range<AdjacencyIterator> Ch(const VID &X) const;
+
     /** \addtogroup vertices
      *  @{
      */
@@ -135,6 +260,52 @@ class IGraph {
      */
     inline virtual void del_vertex(const VID &X) = 0;
 
+    /**
+     * @brief Delete a sequence of vertex ids from the graph.
+     *
+     * Vertices repeated in the sequence are deleted once. Every vertex is
+     * checked before the graph is modified, then the remaining vertex ids
+     * are compacted once for the whole sequence.
+     *
+     * @tparam I Iterator typename.
+     * @tparam require_iter_value_type(I, VID) Require the iterator value type to be VID.
+     * @param begin First iterator.
+     * @param end Last iterator.
+     */
+    template <typename I, require_iter_value_type(I, VID) = 0>
+    inline void del_vertices(const I &begin, const I &end);
+
+    /**
+     * @brief The number of edges entering a vertex is called its in-degree.
+     *
+     * @param X Given vertex id.
+     * @return std::size_t In-degree of the vertex.
+     */
+    inline virtual std::size_t in_degree(const VID &X) const = 0;
+
+    /**
+     * @brief The number of edges leaving a vertex is called its out-degree.
+     *
+     * @param X Given vertex id.
+     * @return std::size_t Out-degree of the vertex.
+     */
+    inline virtual std::size_t out_degree(const VID &X) const = 0;
+
+    /**
+     * @brief The degree of a vertex is the sum of its in-degree and out-degree.
+     *
+     * @param X Given vertex id.
+     * @return std::size_t Degree of the vertex.
+     */
+    inline virtual std::size_t degree(const VID &X) const;
+
+    /**
+     * @brief The degrees of the vertices, indexed by vertex id.
+     *
+     * @return std::vector<std::size_t> Degree of each vertex.
+     */
+    inline virtual std::vector<std::size_t> degree_sequence() const;
+
     /** @}*/
 
     /** \addtogroup edges
@@ -164,9 +335,103 @@ class IGraph {
      */
     inline virtual void del_edge(const EID &X) = 0;
 
+    /**
+     * @brief Add a sequence of edges to the graph.
+     *
+     * Edges already in the graph, or repeated in the sequence, are skipped.
+     * Every vertex is checked before the graph is modified.
+     *
+     * @tparam I Iterator typename.
+     * @tparam require_iter_value_type(I, EID) Require the iterator value type to be EID.
+     * @param begin First iterator.
+     * @param end Last iterator.
+     */
+    template <typename I, require_iter_value_type(I, EID) = 0>
+    inline void add_edges(const I &begin, const I &end);
+
+    /**
+     * @brief Delete a sequence of edges from the graph.
+     *
+     * Edges not in the graph, or repeated in the sequence, are skipped.
+     * Every vertex is checked before the graph is modified.
+     *
+     * @tparam I Iterator typename.
+     * @tparam require_iter_value_type(I, EID) Require the iterator value type to be EID.
+     * @param begin First iterator.
+     * @param end Last iterator.
+     */
+    template <typename I, require_iter_value_type(I, EID) = 0>
+    inline void del_edges(const I &begin, const I &end);
+
     /** @}*/
 
    protected:
+    /**
+     * @brief Check that every vertex of a sequence of edges exists.
+     *
+     * @param first First edge pointer.
+     * @param last Last edge pointer.
+     */
+    inline void check_edges(const EID *first, const EID *last) const;
+
+    /**
+     * @brief Add a contiguous sequence of edges to the graph.
+     *
+     * @param first First edge pointer.
+     * @param last Last edge pointer.
+     */
+    inline virtual void bulk_add_edges(const EID *first, const EID *last);
+
+    /**
+     * @brief Delete a contiguous sequence of edges from the graph.
+     *
+     * @param first First edge pointer.
+     * @param last Last edge pointer.
+     */
+    inline virtual void bulk_del_edges(const EID *first, const EID *last);
+
+    /**
+     * @brief Delete a contiguous sequence of vertices from the graph.
+     *
+     * @param first First vertex pointer, *sorted*, *unique* and existing.
+     * @param last Last vertex pointer.
+     */
+    inline virtual void bulk_del_vertices(const VID *first, const VID *last);
+
+    /**
+     * @brief Advance a cursor over the vertex set.
+     *
+     * Cursors are opaque positions in the native storage, starting from zero.
+     *
+     * @param i Given cursor, advanced past the returned vertex.
+     * @param Y Next vertex id.
+     * @return true If a vertex has been found,
+     * @return false Otherwise.
+     */
+    inline virtual bool next_vertex(std::size_t &i, VID &Y) const;
+
+    /**
+     * @brief Advance a cursor over the children of a vertex.
+     *
+     * @param X Given vertex id.
+     * @param i Given cursor, advanced past the returned child.
+     * @param Y Next child vertex id.
+     * @return true If a child has been found,
+     * @return false Otherwise.
+     */
+    inline virtual bool next_child(const VID &X, std::size_t &i, VID &Y) const = 0;
+
+    /**
+     * @brief Advance a cursor over the parents of a vertex.
+     *
+     * @param X Given vertex id.
+     * @param i Given cursor, advanced past the returned parent.
+     * @param Y Next parent vertex id.
+     * @return true If a parent has been found,
+     * @return false Otherwise.
+     */
+    inline virtual bool next_parent(const VID &X, std::size_t &i, VID &Y) const = 0;
+
     /**
      * @brief Hash function of a graph.
      *
@@ -181,3 +446,143 @@ class IGraph {
      */
     virtual void print(std::ostream &out) const = 0;
 };
+
+//! Input iterator over the vertex set of a graph.
+class IGraph::VertexIterator {
+   protected:
+    //! Iterated graph.
+    const IGraph *G;
+    //! Storage cursor.
+    std::size_t i;
+    //! Current vertex id.
+    VID X;
+    //! Whether the iterator points to a vertex or not.
+    bool valid;
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = VID;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const VID *;
+    using reference = const VID &;
+
+    /**
+     * @brief Construct a new Vertex Iterator object.
+     *
+     * @param G Given graph.
+     * @param end Whether to construct the past-the-end iterator or not.
+     */
+    inline VertexIterator(const IGraph *G, bool end);
+
+    inline reference operator*() const;
+
+    inline pointer operator->() const;
+
+    inline VertexIterator &operator++();
+
+    inline VertexIterator operator++(int);
+
+    inline bool operator==(const VertexIterator &other) const;
+
+    inline bool operator!=(const VertexIterator &other) const;
+};
+
+//! Input iterator over the edge set of a graph.
+class IGraph::EdgeIterator {
+   protected:
+    //! Iterated graph.
+    const IGraph *G;
+    //! Vertex storage cursor.
+    std::size_t i;
+    //! Children storage cursor.
+    std::size_t j;
+    //! Current edge id.
+    EID X;
+    //! Whether the iterator points to an edge or not.
+    bool valid;
+
+    //! Advance to the next edge.
+    inline void advance();
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = EID;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const EID *;
+    using reference = const EID &;
+
+    /**
+     * @brief Construct a new Edge Iterator object.
+     *
+     * @param G Given graph.
+     * @param end Whether to construct the past-the-end iterator or not.
+     */
+    inline EdgeIterator(const IGraph *G, bool end);
+
+    inline reference operator*() const;
+
+    inline pointer operator->() const;
+
+    inline EdgeIterator &operator++();
+
+    inline EdgeIterator operator++(int);
+
+    inline bool operator==(const EdgeIterator &other) const;
+
+    inline bool operator!=(const EdgeIterator &other) const;
+};
+
+//! Input iterator over the parents, children or neighbors of a vertex.
+class IGraph::AdjacencyIterator {
+   public:
+    //! Iterated adjacency.
+    enum Kind { PARENTS, CHILDREN, NEIGHBORS };
+
+   protected:
+    //! Iterated graph.
+    const IGraph *G;
+    //! Iterated adjacency.
+    Kind k;
+    //! Given vertex id.
+    VID X;
+    //! Whether children have been exhausted while iterating neighbors.
+    bool parents;
+    //! Storage cursor.
+    std::size_t i;
+    //! Current vertex id.
+    VID Y;
+    //! Whether the iterator points to a vertex or not.
+    bool valid;
+
+    //! Advance to the next adjacent vertex.
+    inline void advance();
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = VID;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const VID *;
+    using reference = const VID &;
+
+    /**
+     * @brief Construct a new Adjacency Iterator object.
+     *
+     * @param G Given graph.
+     * @param k Given adjacency kind.
+     * @param X Given vertex id.
+     * @param end Whether to construct the past-the-end iterator or not.
+     */
+    inline AdjacencyIterator(const IGraph *G, Kind k, const VID &X, bool end);
+
+    inline reference operator*() const;
+
+    inline pointer operator->() const;
+
+    inline AdjacencyIterator &operator++();
+
+    inline AdjacencyIterator operator++(int);
+
+    inline bool operator==(const AdjacencyIterator &other) const;
+
+    inline bool operator!=(const AdjacencyIterator &other) const;
+};
@@ -1,7 +1,15 @@
 #pragma once
 
+#include "exceptions.hpp"
 #include "interface_graph.hpp"
 
+inline std::size_t mix_hash(std::size_t h) {
+    std::uint64_t z = h + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
 inline IGraph::~IGraph() {}
 
 inline bool IGraph::is_null() const { return order() == 0; }
@@ -10,6 +18,235 @@ inline bool IGraph::is_trivial() const { return order() == 1 && size() == 0; }
 
 inline bool IGraph::is_complete() const { return order() * (order() - 1) / 2 == size(); }
 
+inline std::size_t IGraph::degree(const VID &X) const { return in_degree(X) + out_degree(X); }
+
+inline std::vector<std::size_t> IGraph::degree_sequence() const {
+    // Collect the degree of each vertex, vertex ids may be sparse.
+    std::vector<std::size_t> out;
+    out.reserve(order());
+    for (const VID &X : V()) {
+        if (X >= out.size()) out.resize(X + 1, 0);
+        out[X] = degree(X);
+    }
+    return out;
+}
+
+inline Range<IGraph::VertexIterator> IGraph::V() const {
+    return Range<VertexIterator>(VertexIterator(this, false), VertexIterator(this, true));
+}
+
+inline Range<IGraph::EdgeIterator> IGraph::E() const {
+    return Range<EdgeIterator>(EdgeIterator(this, false), EdgeIterator(this, true));
+}
+
+inline Range<IGraph::AdjacencyIterator> IGraph::Ne(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    return Range<AdjacencyIterator>(AdjacencyIterator(this, AdjacencyIterator::NEIGHBORS, X, false),
+                                    AdjacencyIterator(this, AdjacencyIterator::NEIGHBORS, X, true));
+}
+
+inline Range<IGraph::AdjacencyIterator> IGraph::Pa(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    return Range<AdjacencyIterator>(AdjacencyIterator(this, AdjacencyIterator::PARENTS, X, false),
+                                    AdjacencyIterator(this, AdjacencyIterator::PARENTS, X, true));
+}
+
+inline Range<IGraph::AdjacencyIterator> IGraph::Ch(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);
+    return Range<AdjacencyIterator>(AdjacencyIterator(this, AdjacencyIterator::CHILDREN, X, false),
+                                    AdjacencyIterator(this, AdjacencyIterator::CHILDREN, X, true));
+}
+
+template <typename I, require_iter_value_type(I, EID)>
+inline void IGraph::add_edges(const I &begin, const I &end) {
+    if constexpr (is_contiguous_iterator<I>::value) {
+        // Pass contiguous sequences through without copying.
+        const EID *first = begin == end ? nullptr : &*begin;
+        bulk_add_edges(first, first + std::distance(begin, end));
+    } else {
+        // Collect the sequence into contiguous memory.
+        std::vector<EID> E(begin, end);
+        bulk_add_edges(E.data(), E.data() + E.size());
+    }
+}
+
+template <typename I, require_iter_value_type(I, EID)>
+inline void IGraph::del_edges(const I &begin, const I &end) {
+    if constexpr (is_contiguous_iterator<I>::value) {
+        // Pass contiguous sequences through without copying.
+        const EID *first = begin == end ? nullptr : &*begin;
+        bulk_del_edges(first, first + std::distance(begin, end));
+    } else {
+        // Collect the sequence into contiguous memory.
+        std::vector<EID> E(begin, end);
+        bulk_del_edges(E.data(), E.data() + E.size());
+    }
+}
+
+template <typename I, require_iter_value_type(I, VID)>
+inline void IGraph::del_vertices(const I &begin, const I &end) {
+    // Collect the sequence into sorted unique contiguous memory.
+    std::vector<VID> V(begin, end);
+    std::sort(V.begin(), V.end());
+    V.erase(std::unique(V.begin(), V.end()), V.end());
+    // Check every vertex before modifying the graph.
+    for (const VID &X : V) {
+        if (!has_vertex(X)) throw NOT_DEFINED(X);
+    }
+    bulk_del_vertices(V.data(), V.data() + V.size());
+}
+
+inline void IGraph::check_edges(const EID *first, const EID *last) const {
+    for (const EID *e = first; e != last; e++) {
+        if (!has_vertex(e->first)) throw NOT_DEFINED(e->first);
+        if (!has_vertex(e->second)) throw NOT_DEFINED(e->second);
+    }
+}
+
+inline void IGraph::bulk_add_edges(const EID *first, const EID *last) {
+    check_edges(first, last);
+    // Fall back to single edge insertions.
+    for (const EID *e = first; e != last; e++) {
+        if (!has_edge(*e)) add_edge(*e);
+    }
+}
+
+inline void IGraph::bulk_del_edges(const EID *first, const EID *last) {
+    check_edges(first, last);
+    // Fall back to single edge deletions.
+    for (const EID *e = first; e != last; e++) {
+        if (has_edge(*e)) del_edge(*e);
+    }
+}
+
+inline void IGraph::bulk_del_vertices(const VID *first, const VID *last) {
+    // Fall back to single vertex deletions, from the highest vertex id
+    // so that the remaining ones are not shifted.
+    while (first != last) del_vertex(*--last);
+}
+
+inline bool IGraph::next_vertex(std::size_t &i, VID &Y) const {
+    // Vertices are identified by their position by default.
+    if (i >= order()) return false;
+    Y = i++;
+    return true;
+}
+
+inline IGraph::VertexIterator::VertexIterator(const IGraph *G, bool end) : G(G), i(0), X(0), valid(false) {
+    if (!end) valid = G->next_vertex(i, X);
+}
+
+inline IGraph::VertexIterator::reference IGraph::VertexIterator::operator*() const { return X; }
+
+inline IGraph::VertexIterator::pointer IGraph::VertexIterator::operator->() const { return &X; }
+
+inline IGraph::VertexIterator &IGraph::VertexIterator::operator++() {
+    valid = G->next_vertex(i, X);
+    return *this;
+}
+
+inline IGraph::VertexIterator IGraph::VertexIterator::operator++(int) {
+    VertexIterator tmp(*this);
+    ++(*this);
+    return tmp;
+}
+
+inline bool IGraph::VertexIterator::operator==(const VertexIterator &other) const {
+    // Past-the-end iterators are equal regardless of their cursor.
+    return valid == other.valid && (!valid || i == other.i);
+}
+
+inline bool IGraph::VertexIterator::operator!=(const VertexIterator &other) const { return !(*this == other); }
+
+inline void IGraph::EdgeIterator::advance() {
+    // Look for the next child of the current vertex, then move to the next vertex.
+    while (valid) {
+        if (G->next_child(X.first, j, X.second)) return;
+        valid = G->next_vertex(i, X.first);
+        j = 0;
+    }
+}
+
+inline IGraph::EdgeIterator::EdgeIterator(const IGraph *G, bool end) : G(G), i(0), j(0), X(0, 0), valid(false) {
+    if (!end) {
+        valid = G->next_vertex(i, X.first);
+        advance();
+    }
+}
+
+inline IGraph::EdgeIterator::reference IGraph::EdgeIterator::operator*() const { return X; }
+
+inline IGraph::EdgeIterator::pointer IGraph::EdgeIterator::operator->() const { return &X; }
+
+inline IGraph::EdgeIterator &IGraph::EdgeIterator::operator++() {
+    advance();
+    return *this;
+}
+
+inline IGraph::EdgeIterator IGraph::EdgeIterator::operator++(int) {
+    EdgeIterator tmp(*this);
+    ++(*this);
+    return tmp;
+}
+
+inline bool IGraph::EdgeIterator::operator==(const EdgeIterator &other) const {
+    // Past-the-end iterators are equal regardless of their cursors.
+    return valid == other.valid && (!valid || (i == other.i && j == other.j));
+}
+
+inline bool IGraph::EdgeIterator::operator!=(const EdgeIterator &other) const { return !(*this == other); }
+
+inline void IGraph::AdjacencyIterator::advance() {
+    switch (k) {
+        case PARENTS:
+            valid = G->next_parent(X, i, Y);
+            break;
+        case CHILDREN:
+            valid = G->next_child(X, i, Y);
+            break;
+        case NEIGHBORS:
+            // Iterate over children first.
+            if (!parents) {
+                valid = G->next_child(X, i, Y);
+                if (valid) return;
+                parents = true;
+                i = 0;
+            }
+            // Then over parents that are not children too.
+            do {
+                valid = G->next_parent(X, i, Y);
+            } while (valid && G->has_edge(EID(X, Y)));
+            break;
+    }
+}
+
+inline IGraph::AdjacencyIterator::AdjacencyIterator(const IGraph *G, Kind k, const VID &X, bool end)
+    : G(G), k(k), X(X), parents(false), i(0), Y(0), valid(false) {
+    if (!end) advance();
+}
+
+inline IGraph::AdjacencyIterator::reference IGraph::AdjacencyIterator::operator*() const { return Y; }
+
+inline IGraph::AdjacencyIterator::pointer IGraph::AdjacencyIterator::operator->() const { return &Y; }
+
+inline IGraph::AdjacencyIterator &IGraph::AdjacencyIterator::operator++() {
+    advance();
+    return *this;
+}
+
+inline IGraph::AdjacencyIterator IGraph::AdjacencyIterator::operator++(int) {
+    AdjacencyIterator tmp(*this);
+    ++(*this);
+    return tmp;
+}
+
+inline bool IGraph::AdjacencyIterator::operator==(const AdjacencyIterator &other) const {
+    // Past-the-end iterators are equal regardless of their cursor.
+    return valid == other.valid && (!valid || (parents == other.parents && i == other.i));
+}
+
+inline bool IGraph::AdjacencyIterator::operator!=(const AdjacencyIterator &other) const { return !(*this == other); }
+
 //! Output stream operator adapter.
 std::ostream &operator<<(std::ostream &out, const IGraph &G) {
     G.print(out);
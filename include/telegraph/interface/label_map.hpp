@@ -0,0 +1,198 @@
+#pragma once
+
+#include <boost/container_hash/hash.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "interface_graph.ipp"
+#include "memory_usage.ipp"
+
+/**
+ * @brief Bidirectional mapping between keys and interned labels.
+ *
+ * Labels are stored back to back in a contiguous string arena and identified
+ * by a label id. Labels are found through a flat open-addressing hash table
+ * over the label ids, while keys are mapped to label ids through a dense
+ * vector for vertex ids and a hash map for edge ids. Both directions are
+ * O(1) on average and a lookup never allocates.
+ *
+ * @tparam K Key type, either VID or EID.
+ */
+template <typename K>
+class LabelMap {
+   public:
+    //! Label id returned by find if none.
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+   protected:
+    //! Key to label id index, dense for vertex ids.
+    using Index = std::conditional_t<std::is_same_v<K, VID>, std::vector<std::size_t>,
+                                     std::unordered_map<K, std::size_t, boost::hash<K>>>;
+
+    //! Contiguous storage of the labels.
+    std::string arena;
+    //! Offset of each label in the arena.
+    std::vector<std::size_t> offsets;
+    //! Length of each label, npos if the label id is released.
+    std::vector<std::size_t> lengths;
+    //! Hash of each label.
+    std::vector<std::size_t> hashes;
+    //! Key of each label.
+    std::vector<K> keys;
+    //! Released label ids available for reuse.
+    std::vector<std::size_t> released;
+    //! Open-addressing table of label ids, indexed by label hash.
+    std::vector<std::size_t> table;
+    //! Key to label id index.
+    Index index;
+    //! Number of labels.
+    std::size_t n;
+    //! Number of arena bytes held by released labels.
+    std::size_t garbage;
+    //! Sum of the key and label pair hashes, maintained on each update.
+    std::size_t digest;
+
+    /**
+     * @brief Bind a key to a label id.
+     *
+     * @param X Given key.
+     * @param i Given label id, npos to unbind.
+     */
+    inline void bind(const K &X, std::size_t i);
+
+    /**
+     * @brief Find the table slot of a label id.
+     *
+     * @param i Given label id.
+     * @return std::size_t Table slot.
+     */
+    inline std::size_t slot(std::size_t i) const;
+
+    /**
+     * @brief Hash of the key and label pair of a label id.
+     *
+     * @param i Given label id.
+     * @return std::size_t Pair hash.
+     */
+    inline std::size_t pair_hash(std::size_t i) const;
+
+    /**
+     * @brief Rebuild the hash table with a given capacity.
+     *
+     * @param k Given capacity, a power of two.
+     */
+    inline void rehash(std::size_t k);
+
+    //! Rewrite the arena without the released labels.
+    inline void shrink();
+
+    /**
+     * @brief Smallest table capacity holding a given number of labels.
+     *
+     * @param k Given number of labels.
+     * @return std::size_t Table capacity, zero if there are no labels.
+     */
+    static inline std::size_t fit(std::size_t k);
+
+   public:
+    //! Default constructor for an empty Label Map object.
+    LabelMap();
+
+    //! Number of labels.
+    inline std::size_t size() const;
+
+    //! Whether there are no labels.
+    inline bool empty() const;
+
+    /**
+     * @brief Find the label id of a key.
+     *
+     * @param X Given key.
+     * @return std::size_t Label id, npos if none.
+     */
+    inline std::size_t find(const K &X) const;
+
+    /**
+     * @brief Find the label id of a label.
+     *
+     * @param L Given label.
+     * @return std::size_t Label id, npos if none.
+     */
+    inline std::size_t find(std::string_view L) const;
+
+    /**
+     * @brief The label of a label id.
+     *
+     * The view is invalidated by the next modification.
+     *
+     * @param i Given label id.
+     * @return std::string_view Label.
+     */
+    inline std::string_view label(std::size_t i) const;
+
+    /**
+     * @brief The key of a label id.
+     *
+     * @param i Given label id.
+     * @return const K& Key.
+     */
+    inline const K &key(std::size_t i) const;
+
+    /**
+     * @brief Set the label of a key, replacing its previous label if any.
+     *
+     * The label is assumed not to be set for a different key.
+     *
+     * @param X Given key.
+     * @param L Given label.
+     */
+    inline void set(const K &X, std::string_view L);
+
+    /**
+     * @brief Delete the label of a key, if any.
+     *
+     * @param X Given key.
+     */
+    inline void erase(const K &X);
+
+    /**
+     * @brief Remap the keys after a vertex compaction.
+     *
+     * @param remap Given compaction map, labels of deleted vertices are dropped.
+     * @param m Given number of vertices after compaction.
+     */
+    inline void compact(const std::vector<VID> &remap, std::size_t m);
+
+    /**
+     * @brief Order-independent hash of the key and label pairs.
+     *
+     * The sum of the pair hashes is maintained on each update, hence it takes constant time.
+     *
+     * @return std::size_t Hash value.
+     */
+    inline std::size_t hash() const;
+
+    /**
+     * @brief Heap bytes of the labels, the table and the index.
+     *
+     * @return std::size_t Heap bytes.
+     */
+    inline std::size_t heap_size() const;
+
+    /**
+     * @brief Heap bytes released by shrink_to_fit.
+     *
+     * @return std::size_t Heap bytes of the released labels and of the unused capacity.
+     */
+    inline std::size_t heap_slack() const;
+
+    /**
+     * @brief Renumber the labels densely and release the unused capacity.
+     *
+     * Label ids are invalidated, keys and labels are unchanged.
+     */
+    inline void shrink_to_fit();
+};
@@ -0,0 +1,267 @@
+#pragma once
+
+#include "label_map.hpp"
+
+template <typename K>
+inline void LabelMap<K>::bind(const K &X, std::size_t i) {
+    if constexpr (std::is_same_v<K, VID>) {
+        if (X >= index.size()) index.resize(X + 1, npos);
+        index[X] = i;
+    } else {
+        if (i == npos) {
+            index.erase(X);
+        } else {
+            index[X] = i;
+        }
+    }
+}
+
+template <typename K>
+inline std::size_t LabelMap<K>::slot(std::size_t i) const {
+    const std::size_t mask = table.size() - 1;
+    std::size_t j = hashes[i] & mask;
+    while (table[j] != i) j = (j + 1) & mask;
+    return j;
+}
+
+template <typename K>
+inline std::size_t LabelMap<K>::pair_hash(std::size_t i) const {
+    std::size_t h = 0;
+    boost::hash_combine(h, keys[i]);
+    boost::hash_combine(h, hashes[i]);
+    return h;
+}
+
+template <typename K>
+inline void LabelMap<K>::rehash(std::size_t k) {
+    table.assign(k, npos);
+    const std::size_t mask = k - 1;
+    // Reinsert the label ids by their stored hash, without hashing the labels again.
+    for (std::size_t i = 0; i < lengths.size(); i++) {
+        if (lengths[i] == npos) continue;
+        std::size_t j = hashes[i] & mask;
+        while (table[j] != npos) j = (j + 1) & mask;
+        table[j] = i;
+    }
+}
+
+template <typename K>
+inline void LabelMap<K>::shrink() {
+    std::string out;
+    out.reserve(arena.size() - garbage);
+    for (std::size_t i = 0; i < lengths.size(); i++) {
+        if (lengths[i] == npos) continue;
+        std::size_t k = out.size();
+        out.append(arena, offsets[i], lengths[i]);
+        offsets[i] = k;
+    }
+    arena = std::move(out);
+    garbage = 0;
+}
+
+template <typename K>
+LabelMap<K>::LabelMap() : n(0), garbage(0), digest(0) {}
+
+template <typename K>
+inline std::size_t LabelMap<K>::size() const {
+    return n;
+}
+
+template <typename K>
+inline bool LabelMap<K>::empty() const {
+    return n == 0;
+}
+
+template <typename K>
+inline std::size_t LabelMap<K>::find(const K &X) const {
+    if constexpr (std::is_same_v<K, VID>) {
+        return X < index.size() ? index[X] : npos;
+    } else {
+        auto i = index.find(X);
+        return i == index.end() ? npos : i->second;
+    }
+}
+
+template <typename K>
+inline std::size_t LabelMap<K>::find(std::string_view L) const {
+    if (n == 0) return npos;
+    // Probe linearly from the home slot, comparing hashes before labels.
+    const std::size_t h = std::hash<std::string_view>()(L);
+    const std::size_t mask = table.size() - 1;
+    for (std::size_t j = h & mask; table[j] != npos; j = (j + 1) & mask) {
+        std::size_t i = table[j];
+        if (hashes[i] == h && label(i) == L) return i;
+    }
+    return npos;
+}
+
+template <typename K>
+inline std::string_view LabelMap<K>::label(std::size_t i) const {
+    return std::string_view(arena.data() + offsets[i], lengths[i]);
+}
+
+template <typename K>
+inline const K &LabelMap<K>::key(std::size_t i) const {
+    return keys[i];
+}
+
+template <typename K>
+inline void LabelMap<K>::set(const K &X, std::string_view L) {
+    // Release the previous label, if any.
+    erase(X);
+    // Grow the table geometrically to keep the load factor below 1/2.
+    if (2 * (n + 1) > table.size()) rehash(std::max<std::size_t>(16, 2 * table.size()));
+    // Allocate a label id, reusing a released one if any.
+    std::size_t i = lengths.size();
+    if (released.empty()) {
+        offsets.push_back(0);
+        lengths.push_back(0);
+        hashes.push_back(0);
+        keys.push_back(X);
+    } else {
+        i = released.back();
+        released.pop_back();
+    }
+    // Append the label to the arena.
+    offsets[i] = arena.size();
+    lengths[i] = L.size();
+    hashes[i] = std::hash<std::string_view>()(L);
+    keys[i] = X;
+    arena.append(L);
+    // Insert the label id in the table.
+    const std::size_t mask = table.size() - 1;
+    std::size_t j = hashes[i] & mask;
+    while (table[j] != npos) j = (j + 1) & mask;
+    table[j] = i;
+    bind(X, i);
+    n++;
+    digest += pair_hash(i);
+}
+
+template <typename K>
+inline void LabelMap<K>::erase(const K &X) {
+    std::size_t i = find(X);
+    if (i == npos) return;
+    digest -= pair_hash(i);
+    // Shift back the following entries of the probe sequence to fill the hole.
+    const std::size_t mask = table.size() - 1;
+    std::size_t j = slot(i);
+    for (std::size_t k = (j + 1) & mask; table[k] != npos; k = (k + 1) & mask) {
+        std::size_t h = hashes[table[k]] & mask;
+        // Skip entries whose home slot lies cyclically in (j, k].
+        if (j <= k ? (j < h && h <= k) : (j < h || h <= k)) continue;
+        table[j] = table[k];
+        j = k;
+    }
+    table[j] = npos;
+    // Release the label id.
+    garbage += lengths[i];
+    lengths[i] = npos;
+    released.push_back(i);
+    bind(X, npos);
+    n--;
+    // Rewrite the arena once most of it is garbage.
+    if (garbage > 4096 && 2 * garbage > arena.size()) shrink();
+}
+
+template <typename K>
+inline void LabelMap<K>::compact(const std::vector<VID> &remap, std::size_t m) {
+    // Collect the keys of deleted vertices, or of their edges.
+    std::vector<K> E;
+    for (std::size_t i = 0; i < lengths.size(); i++) {
+        if (lengths[i] == npos) continue;
+        if constexpr (std::is_same_v<K, VID>) {
+            if (remap[keys[i]] >= m) E.push_back(keys[i]);
+        } else {
+            if (remap[keys[i].first] >= m || remap[keys[i].second] >= m) E.push_back(keys[i]);
+        }
+    }
+    for (const K &X : E) erase(X);
+    // Rekey the remaining labels, the label ids are unchanged.
+    index = Index();
+    if constexpr (std::is_same_v<K, VID>) index.assign(m, npos);
+    for (std::size_t i = 0; i < lengths.size(); i++) {
+        if (lengths[i] == npos) continue;
+        digest -= pair_hash(i);
+        if constexpr (std::is_same_v<K, VID>) {
+            keys[i] = remap[keys[i]];
+        } else {
+            keys[i] = K(remap[keys[i].first], remap[keys[i].second]);
+        }
+        digest += pair_hash(i);
+        bind(keys[i], i);
+    }
+}
+
+template <typename K>
+inline std::size_t LabelMap<K>::hash() const {
+    return digest;
+}
+
+template <typename K>
+inline std::size_t LabelMap<K>::fit(std::size_t k) {
+    if (k == 0) return 0;
+    // Keep the load factor below 1/2, as set does.
+    std::size_t c = 16;
+    while (2 * k > c) c *= 2;
+    return c;
+}
+
+template <typename K>
+inline std::size_t LabelMap<K>::heap_size() const {
+    std::size_t out = ::heap_size(arena) + ::heap_size(offsets) + ::heap_size(lengths) + ::heap_size(hashes) +
+                      ::heap_size(keys) + ::heap_size(released) + ::heap_size(table);
+    return out + ::heap_size(index);
+}
+
+template <typename K>
+inline std::size_t LabelMap<K>::heap_slack() const {
+    // Released label ids still hold their entries.
+    std::size_t out = released.size() * (3 * sizeof(std::size_t) + sizeof(K)) + ::heap_size(released);
+    out += ::heap_slack(offsets) + ::heap_slack(lengths) + ::heap_slack(hashes) + ::heap_slack(keys);
+    out += (table.size() - fit(n)) * sizeof(std::size_t) + ::heap_slack(table);
+    if (::heap_size(arena) > 0) out += garbage + arena.capacity() - arena.size();
+    if constexpr (std::is_same_v<K, VID>) out += ::heap_slack(index);
+    return out;
+}
+
+template <typename K>
+inline void LabelMap<K>::shrink_to_fit() {
+    // Copy the labels to exactly sized storage, in label id order.
+    std::string a;
+    a.reserve(arena.size() - garbage);
+    std::vector<std::size_t> o, l, h;
+    std::vector<K> k;
+    o.reserve(n);
+    l.reserve(n);
+    h.reserve(n);
+    k.reserve(n);
+    for (std::size_t i = 0; i < lengths.size(); i++) {
+        if (lengths[i] == npos) continue;
+        o.push_back(a.size());
+        l.push_back(lengths[i]);
+        h.push_back(hashes[i]);
+        k.push_back(keys[i]);
+        a.append(arena, offsets[i], lengths[i]);
+    }
+    arena = std::move(a);
+    arena.shrink_to_fit();
+    offsets = std::move(o);
+    lengths = std::move(l);
+    hashes = std::move(h);
+    keys = std::move(k);
+    std::vector<std::size_t>().swap(released);
+    garbage = 0;
+    // Rebuild the table and the index, the digest is unchanged.
+    std::vector<std::size_t>().swap(table);
+    rehash(fit(n));
+    index = Index();
+    if constexpr (std::is_same_v<K, VID>) {
+        VID m = 0;
+        for (const K &X : keys) m = std::max(m, X + 1);
+        index.assign(m, npos);
+    } else {
+        index.reserve(n);
+    }
+    for (std::size_t i = 0; i < keys.size(); i++) bind(keys[i], i);
+}
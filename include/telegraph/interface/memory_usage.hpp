@@ -0,0 +1,105 @@
+#pragma once
+
+#include <any>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Memory used by a graph, in bytes, by component.
+ *
+ * Heap sizes are computed from the capacities of the containers, hence they
+ * include the allocated but unused storage, which is also reported as slack
+ * and released by shrink_to_fit. Node-based containers are accounted with
+ * the node layout of the common standard library implementations, values
+ * held in std::any are accounted for arithmetic types and std::string only.
+ */
+struct MemoryUsage {
+    //! Adjacency storage and degree counters.
+    std::size_t adjacency = 0;
+    //! Vertex labels and their index.
+    std::size_t vertex_labels = 0;
+    //! Edge labels and their index.
+    std::size_t edge_labels = 0;
+    //! Graph label and attributes.
+    std::size_t graph_attributes = 0;
+    //! Vertex attribute columns.
+    std::size_t vertex_attributes = 0;
+    //! Edge attribute columns and their edge slots.
+    std::size_t edge_attributes = 0;
+    //! Other bookkeeping, e.g. the deleted vertices.
+    std::size_t other = 0;
+    //! Allocated but unused bytes, included in the components above.
+    std::size_t slack = 0;
+    //! Bytes of memory-mapped files, backed by the page cache instead of the heap.
+    std::size_t mapped = 0;
+
+    /**
+     * @brief Total heap memory, excluding the memory-mapped bytes.
+     *
+     * @return std::size_t Sum of the components, in bytes.
+     */
+    inline std::size_t total() const;
+};
+
+//! Bytes per node of a node-based container, beside its value.
+static constexpr std::size_t NODE_OVERHEAD = 4 * sizeof(void *);
+
+/**
+ * @brief Heap bytes of a string, zero if stored inline.
+ *
+ * @param s Given string.
+ * @return std::size_t Heap bytes.
+ */
+inline std::size_t heap_size(const std::string &s);
+
+/**
+ * @brief Heap bytes of a vector, excluding the heap of its values.
+ *
+ * @tparam T Value typename.
+ * @param v Given vector.
+ * @return std::size_t Heap bytes.
+ */
+template <typename T>
+inline std::size_t heap_size(const std::vector<T> &v);
+
+/**
+ * @brief Unused heap bytes of a vector.
+ *
+ * @tparam T Value typename.
+ * @param v Given vector.
+ * @return std::size_t Heap bytes beyond the size of the vector.
+ */
+template <typename T>
+inline std::size_t heap_slack(const std::vector<T> &v);
+
+/**
+ * @brief Heap bytes of an unordered map, excluding the heap of its keys and values.
+ *
+ * @tparam K Key typename.
+ * @tparam V Value typename.
+ * @tparam H Hash typename.
+ * @param m Given unordered map.
+ * @return std::size_t Heap bytes of the buckets and of the nodes.
+ */
+template <typename K, typename V, typename H>
+inline std::size_t heap_size(const std::unordered_map<K, V, H> &m);
+
+/**
+ * @brief Heap bytes of a value held in a std::any.
+ *
+ * @param x Given value.
+ * @return std::size_t Heap bytes, zero for the types other than std::string.
+ */
+inline std::size_t heap_size(const std::any &x);
+
+/**
+ * @brief Heap bytes of a map of std::any values, including the heap of its keys and values.
+ *
+ * @param m Given map.
+ * @return std::size_t Heap bytes.
+ */
+inline std::size_t heap_size(const std::map<std::string, std::any> &m);
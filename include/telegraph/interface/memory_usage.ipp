@@ -0,0 +1,52 @@
+#pragma once
+
+#include "memory_usage.hpp"
+
+inline std::size_t MemoryUsage::total() const {
+    return adjacency + vertex_labels + edge_labels + graph_attributes + vertex_attributes + edge_attributes + other;
+}
+
+inline std::size_t heap_size(const std::string &s) {
+    // Short strings are stored inside the object itself.
+    const char *p = s.data();
+    const char *o = reinterpret_cast<const char *>(&s);
+    if (p >= o && p < o + sizeof(s)) return 0;
+    return s.capacity() + 1;
+}
+
+template <typename T>
+inline std::size_t heap_size(const std::vector<T> &v) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return (v.capacity() + 7) / 8;
+    } else {
+        return v.capacity() * sizeof(T);
+    }
+}
+
+template <typename T>
+inline std::size_t heap_slack(const std::vector<T> &v) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return (v.capacity() - v.size()) / 8;
+    } else {
+        return (v.capacity() - v.size()) * sizeof(T);
+    }
+}
+
+template <typename K, typename V, typename H>
+inline std::size_t heap_size(const std::unordered_map<K, V, H> &m) {
+    // Each node holds the next pointer, the value and the cached hash.
+    const std::size_t node = sizeof(void *) + sizeof(std::pair<const K, V>) + sizeof(std::size_t);
+    return m.bucket_count() * sizeof(void *) + m.size() * node;
+}
+
+inline std::size_t heap_size(const std::any &x) {
+    // Values other than strings are assumed to be stored inline.
+    if (x.type() == typeid(std::string)) return sizeof(std::string) + heap_size(*std::any_cast<std::string>(&x));
+    return 0;
+}
+
+inline std::size_t heap_size(const std::map<std::string, std::any> &m) {
+    std::size_t out = m.size() * (NODE_OVERHEAD + sizeof(std::pair<const std::string, std::any>));
+    for (const auto &[key, value] : m) out += heap_size(key) + heap_size(value);
+    return out;
+}
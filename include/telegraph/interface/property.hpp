@@ -0,0 +1,610 @@
+#pragma once
+
+#include <any>
+#include <boost/container_hash/hash.hpp>
+#include <map>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include "interface_graph.ipp"
+#include "memory_usage.ipp"
+
+/**
+ * @brief Type-erased property column.
+ *
+ * A column stores the values of a single attribute key, indexed by slot.
+ */
+class IColumn {
+   public:
+    //! Destroy the Column object.
+    inline virtual ~IColumn();
+
+    /**
+     * @brief Deep copy of the column.
+     *
+     * @return std::unique_ptr<IColumn> Copied column.
+     */
+    inline virtual std::unique_ptr<IColumn> clone() const = 0;
+
+    /**
+     * @brief Type of the stored values.
+     *
+     * @return const std::type_info& Value type.
+     */
+    inline virtual const std::type_info &type() const = 0;
+
+    /**
+     * @brief Check if a slot holds a value.
+     *
+     * @param i Given slot.
+     * @return true If the slot holds a value,
+     * @return false Otherwise.
+     */
+    inline virtual bool has(std::size_t i) const = 0;
+
+    /**
+     * @brief Reset a slot to the default value.
+     *
+     * @param i Given slot.
+     */
+    inline virtual void erase(std::size_t i) = 0;
+
+    /**
+     * @brief Move each slot to its mapped position in a single pass.
+     *
+     * @param remap Given monotonic slot map, slots mapped to *n* or beyond are dropped.
+     * @param n Given number of slots after compaction.
+     */
+    inline virtual void compact(const std::vector<VID> &remap, std::size_t n) = 0;
+
+    /**
+     * @brief Heap bytes of the column, including the column object and the heap of its values.
+     *
+     * @return std::size_t Heap bytes.
+     */
+    inline virtual std::size_t heap_size() const = 0;
+
+    /**
+     * @brief Heap bytes allocated beyond the last slot holding a value.
+     *
+     * @return std::size_t Heap bytes.
+     */
+    inline virtual std::size_t heap_slack() const = 0;
+
+    //! Drop the slots beyond the last one holding a value and release the unused capacity.
+    inline virtual void shrink_to_fit() = 0;
+};
+
+/**
+ * @brief Dense property column of a given type.
+ *
+ * Values are stored contiguously and unboxed, slots without a value hold the
+ * default value of T, which is returned when reading them.
+ *
+ * @tparam T Value type, *default constructible*.
+ */
+template <typename T>
+class Column : public IColumn {
+   protected:
+    //! Value wrapper, avoiding the std::vector<bool> specialization.
+    struct Cell {
+        T value;
+    };
+
+    //! Stored values.
+    std::vector<Cell> cells;
+    //! Whether each slot holds a value.
+    std::vector<bool> mask;
+    //! Default value returned for empty slots.
+    T none;
+
+   public:
+    //! Default constructor for an empty Column object.
+    Column();
+
+    inline virtual std::unique_ptr<IColumn> clone() const override;
+
+    inline virtual const std::type_info &type() const override;
+
+    inline virtual bool has(std::size_t i) const override;
+
+    /**
+     * @brief Read the value of a slot, without checks.
+     *
+     * @param i Given slot.
+     * @return const T& Stored value, default value if none.
+     */
+    inline const T &get(std::size_t i) const;
+
+    /**
+     * @brief Access the value of a slot, allocating it if needed.
+     *
+     * @param i Given slot.
+     * @return T& Stored value.
+     */
+    inline T &at(std::size_t i);
+
+    inline virtual void erase(std::size_t i) override;
+
+    inline virtual void compact(const std::vector<VID> &remap, std::size_t n) override;
+
+    inline virtual std::size_t heap_size() const override;
+
+    inline virtual std::size_t heap_slack() const override;
+
+    inline virtual void shrink_to_fit() override;
+};
+
+/**
+ * @brief Set of property columns indexed by attribute key.
+ *
+ * Each key is bound to a single value type, set by its first use.
+ */
+class PropertyTable {
+   protected:
+    //! Columns indexed by attribute key.
+    std::map<std::string, std::unique_ptr<IColumn>> columns;
+
+   public:
+    //! Default constructor for an empty Property Table object.
+    PropertyTable();
+
+    //! Copy constructor for a new Property Table object, columns are copied.
+    PropertyTable(const PropertyTable &other);
+
+    //! Copy assignment operator.
+    PropertyTable &operator=(const PropertyTable &other);
+
+    //! Move constructor for a new Property Table object.
+    PropertyTable(PropertyTable &&other) = default;
+
+    //! Move assignment operator.
+    PropertyTable &operator=(PropertyTable &&other) = default;
+
+    /**
+     * @brief Find the column of a given key.
+     *
+     * @param key Given attribute key.
+     * @return const IColumn* Column pointer, nullptr if none.
+     */
+    inline const IColumn *find(const std::string &key) const;
+
+    /**
+     * @brief Keys of the columns, in sorted order.
+     *
+     * @return std::vector<std::string> Attribute keys.
+     */
+    inline std::vector<std::string> keys() const;
+
+    /**
+     * @brief Get the typed column of a given key, creating it if needed.
+     *
+     * @tparam T Value type.
+     * @param key Given attribute key.
+     * @return Column<T>& Typed column.
+     * @throws std::bad_any_cast If the key is bound to a different type.
+     */
+    template <typename T>
+    inline Column<T> &column(const std::string &key);
+
+    /**
+     * @brief Get the typed column of a given key.
+     *
+     * @tparam T Value type.
+     * @param key Given attribute key.
+     * @return const Column<T>& Typed column.
+     * @throws std::bad_any_cast If the key is bound to a different type.
+     */
+    template <typename T>
+    inline const Column<T> &column(const std::string &key) const;
+
+    /**
+     * @brief Reset a slot in every column.
+     *
+     * @param i Given slot.
+     */
+    inline void erase(std::size_t i);
+
+    /**
+     * @brief Reset a slot in the column of a given key.
+     *
+     * @param key Given attribute key.
+     * @param i Given slot.
+     */
+    inline void erase(const std::string &key, std::size_t i);
+
+    /**
+     * @brief Heap bytes of the columns, including their keys and values.
+     *
+     * @return std::size_t Heap bytes.
+     */
+    inline std::size_t heap_size() const;
+
+    /**
+     * @brief Heap bytes of the columns allocated beyond their last slot holding a value.
+     *
+     * @return std::size_t Heap bytes.
+     */
+    inline std::size_t heap_slack() const;
+
+    //! Release the unused capacity of every column.
+    inline void shrink_to_fit();
+};
+
+/**
+ * @brief Vertex property table, slots are vertex ids.
+ */
+class VertexTable : public PropertyTable {
+   public:
+    /**
+     * @brief Compact every column after a vertex deletion.
+     *
+     * @param remap Given compaction map, deleted vertices are mapped beyond *n*.
+     * @param n Given number of vertices after compaction.
+     */
+    inline void compact(const std::vector<VID> &remap, std::size_t n);
+};
+
+/**
+ * @brief Edge property table, each edge with a value is assigned a stable slot.
+ */
+class EdgeTable : public PropertyTable {
+   protected:
+    //! Slot of each edge with at least one value.
+    std::unordered_map<EID, std::size_t, boost::hash<EID>> slots;
+    //! Released slots available for reuse.
+    std::vector<std::size_t> released;
+    //! Number of allocated slots.
+    std::size_t n;
+
+   public:
+    //! Default constructor for an empty Edge Table object.
+    EdgeTable();
+
+    using PropertyTable::erase;
+
+    /**
+     * @brief Find the slot of a given edge.
+     *
+     * @param X Given edge id.
+     * @return std::size_t Slot, npos if none.
+     */
+    inline std::size_t find_slot(const EID &X) const;
+
+    /**
+     * @brief Get the slot of a given edge, allocating it if needed.
+     *
+     * @param X Given edge id.
+     * @return std::size_t Slot.
+     */
+    inline std::size_t slot(const EID &X);
+
+    /**
+     * @brief Release the slot of a given edge, resetting its values.
+     *
+     * @param X Given edge id.
+     */
+    inline void erase(const EID &X);
+
+    /**
+     * @brief Rekey the slots after a vertex deletion, releasing the slots of deleted edges.
+     *
+     * @param remap Given compaction map, deleted vertices are mapped beyond *n*.
+     * @param n Given number of vertices after compaction.
+     */
+    inline void compact(const std::vector<VID> &remap, std::size_t n);
+
+    /**
+     * @brief Heap bytes of the columns and of the edge slots.
+     *
+     * @return std::size_t Heap bytes.
+     */
+    inline std::size_t heap_size() const;
+
+    /**
+     * @brief Heap bytes of the columns beyond their last used slot and of the released slots.
+     *
+     * Cells of released slots followed by used ones are not accounted.
+     *
+     * @return std::size_t Heap bytes.
+     */
+    inline std::size_t heap_slack() const;
+
+    /**
+     * @brief Renumber the used slots densely, in order, and release the unused capacity.
+     */
+    inline void shrink_to_fit();
+
+    //! Slot value returned by find_slot if none.
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+};
+
+/**
+ * @brief Typed handle to a vertex property column.
+ *
+ * Access is O(1) and unboxed. Vertex ids are checked against the graph,
+ * reading a value never allocates it and only an assignment marks the
+ * vertex as having a value. The handle is invalidated when its graph is
+ * destroyed or assigned.
+ *
+ * @tparam T Value type.
+ */
+template <typename T>
+class VertexProperty {
+   protected:
+    //! Referenced graph.
+    const IGraph *G;
+    //! Referenced column.
+    Column<T> *c;
+
+   public:
+    /**
+     * @brief Proxy to the value of a vertex, reading on conversion and writing on assignment.
+     */
+    class Reference {
+       protected:
+        //! Referenced column.
+        Column<T> *c;
+        //! Referenced slot.
+        std::size_t i;
+
+       public:
+        /**
+         * @brief Construct a new Reference object.
+         *
+         * @param c Given column.
+         * @param i Given slot.
+         */
+        Reference(Column<T> *c, std::size_t i);
+
+        //! Copy constructor for a new Reference object, referencing the same value.
+        Reference(const Reference &other) = default;
+
+        /**
+         * @brief Read the value.
+         *
+         * @return const T& Vertex value, default value if none.
+         */
+        inline const T &get() const;
+
+        //! Read the value, default value if none.
+        inline operator const T &() const;
+
+        /**
+         * @brief Write the value, allocating it if needed.
+         *
+         * @param value Given value.
+         * @return Reference& This reference.
+         */
+        inline Reference &operator=(const T &value);
+
+        //! Write the value referenced by another reference.
+        inline Reference &operator=(const Reference &other);
+    };
+
+    /**
+     * @brief Construct a new Vertex Property handle.
+     *
+     * @param G Given graph.
+     * @param c Given column.
+     */
+    VertexProperty(const IGraph *G, Column<T> *c);
+
+    /**
+     * @brief Access the value of a vertex.
+     *
+     * @param X Given vertex id.
+     * @return Reference Vertex value proxy.
+     * @throws NOT_DEFINED If the vertex is not defined.
+     */
+    inline Reference operator[](const VID &X);
+
+    /**
+     * @brief Read the value of a vertex.
+     *
+     * @param X Given vertex id.
+     * @return const T& Vertex value, default value if none.
+     * @throws NOT_DEFINED If the vertex is not defined.
+     */
+    inline const T &operator[](const VID &X) const;
+
+    /**
+     * @brief Check if a vertex has a value.
+     *
+     * @param X Given vertex id.
+     * @return true If the vertex has a value,
+     * @return false Otherwise.
+     */
+    inline bool has(const VID &X) const;
+};
+
+/**
+ * @brief Read-only typed handle to a vertex property column.
+ *
+ * Access is O(1) and unboxed, no check is performed on the vertex ids.
+ * The handle is invalidated when its graph is destroyed or assigned.
+ *
+ * @tparam T Value type.
+ */
+template <typename T>
+class ConstVertexProperty {
+   protected:
+    //! Referenced column.
+    const Column<T> *c;
+
+   public:
+    /**
+     * @brief Construct a new Const Vertex Property handle.
+     *
+     * @param c Given column.
+     */
+    explicit ConstVertexProperty(const Column<T> *c);
+
+    /**
+     * @brief Read the value of a vertex.
+     *
+     * @param X Given vertex id.
+     * @return const T& Vertex value, default value if none.
+     */
+    inline const T &operator[](const VID &X) const;
+
+    /**
+     * @brief Check if a vertex has a value.
+     *
+     * @param X Given vertex id.
+     * @return true If the vertex has a value,
+     * @return false Otherwise.
+     */
+    inline bool has(const VID &X) const;
+};
+
+/**
+ * @brief Typed handle to an edge property column.
+ *
+ * Access is O(1) on average and unboxed. Edge ids are checked against the
+ * graph, reading a value never allocates its slot and only an assignment
+ * marks the edge as having a value. The handle is invalidated when its
+ * graph is destroyed or assigned.
+ *
+ * @tparam T Value type.
+ */
+template <typename T>
+class EdgeProperty {
+   protected:
+    //! Referenced graph.
+    const IGraph *G;
+    //! Referenced edge table.
+    EdgeTable *t;
+    //! Referenced column.
+    Column<T> *c;
+
+   public:
+    /**
+     * @brief Proxy to the value of an edge, reading on conversion and writing on assignment.
+     */
+    class Reference {
+       protected:
+        //! Referenced edge table.
+        EdgeTable *t;
+        //! Referenced column.
+        Column<T> *c;
+        //! Referenced edge id.
+        EID X;
+
+       public:
+        /**
+         * @brief Construct a new Reference object.
+         *
+         * @param t Given edge table.
+         * @param c Given column.
+         * @param X Given edge id.
+         */
+        Reference(EdgeTable *t, Column<T> *c, const EID &X);
+
+        //! Copy constructor for a new Reference object, referencing the same value.
+        Reference(const Reference &other) = default;
+
+        /**
+         * @brief Read the value.
+         *
+         * @return const T& Edge value, default value if none.
+         */
+        inline const T &get() const;
+
+        //! Read the value, default value if none.
+        inline operator const T &() const;
+
+        /**
+         * @brief Write the value, allocating its slot if needed.
+         *
+         * @param value Given value.
+         * @return Reference& This reference.
+         */
+        inline Reference &operator=(const T &value);
+
+        //! Write the value referenced by another reference.
+        inline Reference &operator=(const Reference &other);
+    };
+
+    /**
+     * @brief Construct a new Edge Property handle.
+     *
+     * @param G Given graph.
+     * @param t Given edge table.
+     * @param c Given column.
+     */
+    EdgeProperty(const IGraph *G, EdgeTable *t, Column<T> *c);
+
+    /**
+     * @brief Access the value of an edge.
+     *
+     * @param X Given edge id.
+     * @return Reference Edge value proxy.
+     * @throws NOT_DEFINED If the edge is not defined.
+     */
+    inline Reference operator[](const EID &X);
+
+    /**
+     * @brief Read the value of an edge.
+     *
+     * @param X Given edge id.
+     * @return const T& Edge value, default value if none.
+     * @throws NOT_DEFINED If the edge is not defined.
+     */
+    inline const T &operator[](const EID &X) const;
+
+    /**
+     * @brief Check if an edge has a value.
+     *
+     * @param X Given edge id.
+     * @return true If the edge has a value,
+     * @return false Otherwise.
+     */
+    inline bool has(const EID &X) const;
+};
+
+/**
+ * @brief Read-only typed handle to an edge property column.
+ *
+ * Access is O(1) on average and unboxed, no check is performed on the edge ids.
+ * The handle is invalidated when its graph is destroyed or assigned.
+ *
+ * @tparam T Value type.
+ */
+template <typename T>
+class ConstEdgeProperty {
+   protected:
+    //! Referenced edge table.
+    const EdgeTable *t;
+    //! Referenced column.
+    const Column<T> *c;
+
+   public:
+    /**
+     * @brief Construct a new Const Edge Property handle.
+     *
+     * @param t Given edge table.
+     * @param c Given column.
+     */
+    ConstEdgeProperty(const EdgeTable *t, const Column<T> *c);
+
+    /**
+     * @brief Read the value of an edge.
+     *
+     * @param X Given edge id.
+     * @return const T& Edge value, default value if none.
+     */
+    inline const T &operator[](const EID &X) const;
+
+    /**
+     * @brief Check if an edge has a value.
+     *
+     * @param X Given edge id.
+     * @return true If the edge has a value,
+     * @return false Otherwise.
+     */
+    inline bool has(const EID &X) const;
+};
@@ -0,0 +1,356 @@
+#pragma once
+
+#include "property.hpp"
+
+inline IColumn::~IColumn() {}
+
+template <typename T>
+Column<T>::Column() : none() {}
+
+template <typename T>
+inline std::unique_ptr<IColumn> Column<T>::clone() const {
+    return std::make_unique<Column<T>>(*this);
+}
+
+template <typename T>
+inline const std::type_info &Column<T>::type() const {
+    return typeid(T);
+}
+
+template <typename T>
+inline bool Column<T>::has(std::size_t i) const {
+    return i < mask.size() && mask[i];
+}
+
+template <typename T>
+inline const T &Column<T>::get(std::size_t i) const {
+    return i < cells.size() ? cells[i].value : none;
+}
+
+template <typename T>
+inline T &Column<T>::at(std::size_t i) {
+    // Grow geometrically, new slots hold the default value.
+    if (i >= cells.size()) {
+        std::size_t k = std::max(i + 1, 2 * cells.size());
+        cells.resize(k);
+        mask.resize(k, false);
+    }
+    mask[i] = true;
+    return cells[i].value;
+}
+
+template <typename T>
+inline void Column<T>::erase(std::size_t i) {
+    if (!has(i)) return;
+    // Release the resources held by the value.
+    cells[i].value = T();
+    mask[i] = false;
+}
+
+template <typename T>
+inline void Column<T>::compact(const std::vector<VID> &remap, std::size_t n) {
+    // The map is monotonic, hence values can be moved in place front to back.
+    std::size_t k = std::min(cells.size(), remap.size()), w = 0;
+    for (std::size_t i = 0; i < k; i++) {
+        if (remap[i] >= n) continue;
+        if (remap[i] != i) {
+            cells[remap[i]].value = std::move(cells[i].value);
+            mask[remap[i]] = mask[i];
+        }
+        w = remap[i] + 1;
+    }
+    // Reset the slots left behind.
+    for (std::size_t i = w; i < cells.size(); i++) erase(i);
+    // Drop the trailing slots.
+    if (cells.size() > n) {
+        cells.resize(n);
+        mask.resize(n);
+    }
+}
+
+template <typename T>
+inline std::size_t Column<T>::heap_size() const {
+    std::size_t out = sizeof(*this) + ::heap_size(cells) + ::heap_size(mask);
+    // Account for the heap of string values.
+    if constexpr (std::is_same_v<T, std::string>) {
+        for (const Cell &x : cells) out += ::heap_size(x.value);
+    }
+    return out;
+}
+
+template <typename T>
+inline std::size_t Column<T>::heap_slack() const {
+    std::size_t k = cells.size();
+    while (k > 0 && !mask[k - 1]) k--;
+    return (cells.capacity() - k) * sizeof(Cell) + (mask.capacity() - k) / 8;
+}
+
+template <typename T>
+inline void Column<T>::shrink_to_fit() {
+    // Empty slots hold the default value, hence trailing ones can be dropped.
+    std::size_t k = cells.size();
+    while (k > 0 && !mask[k - 1]) k--;
+    cells.resize(k);
+    mask.resize(k);
+    cells.shrink_to_fit();
+    mask.shrink_to_fit();
+}
+
+PropertyTable::PropertyTable() {}
+
+PropertyTable::PropertyTable(const PropertyTable &other) {
+    for (const auto &[key, c] : other.columns) columns.emplace_hint(columns.end(), key, c->clone());
+}
+
+PropertyTable &PropertyTable::operator=(const PropertyTable &other) {
+    if (this != &other) *this = PropertyTable(other);
+    return *this;
+}
+
+inline const IColumn *PropertyTable::find(const std::string &key) const {
+    auto i = columns.find(key);
+    return i == columns.end() ? nullptr : i->second.get();
+}
+
+inline std::vector<std::string> PropertyTable::keys() const {
+    std::vector<std::string> out;
+    out.reserve(columns.size());
+    for (const auto &c : columns) out.push_back(c.first);
+    return out;
+}
+
+template <typename T>
+inline Column<T> &PropertyTable::column(const std::string &key) {
+    auto &c = columns[key];
+    if (!c) c = std::make_unique<Column<T>>();
+    // Check that the key is bound to the requested type.
+    if (c->type() != typeid(T)) throw std::bad_any_cast();
+    return static_cast<Column<T> &>(*c);
+}
+
+template <typename T>
+inline const Column<T> &PropertyTable::column(const std::string &key) const {
+    const IColumn *c = find(key);
+    if (c == nullptr) throw NO_KEY(key);
+    // Check that the key is bound to the requested type.
+    if (c->type() != typeid(T)) throw std::bad_any_cast();
+    return static_cast<const Column<T> &>(*c);
+}
+
+inline void PropertyTable::erase(std::size_t i) {
+    for (auto &[key, c] : columns) c->erase(i);
+}
+
+inline void PropertyTable::erase(const std::string &key, std::size_t i) {
+    auto c = columns.find(key);
+    if (c != columns.end()) c->second->erase(i);
+}
+
+inline std::size_t PropertyTable::heap_size() const {
+    std::size_t out = columns.size() * (NODE_OVERHEAD + sizeof(std::pair<const std::string, std::unique_ptr<IColumn>>));
+    for (const auto &[key, c] : columns) out += ::heap_size(key) + c->heap_size();
+    return out;
+}
+
+inline std::size_t PropertyTable::heap_slack() const {
+    std::size_t out = 0;
+    for (const auto &[key, c] : columns) out += c->heap_slack();
+    return out;
+}
+
+inline void PropertyTable::shrink_to_fit() {
+    for (auto &[key, c] : columns) c->shrink_to_fit();
+}
+
+inline void VertexTable::compact(const std::vector<VID> &remap, std::size_t n) {
+    for (auto &[key, c] : columns) c->compact(remap, n);
+}
+
+EdgeTable::EdgeTable() : n(0) {}
+
+inline std::size_t EdgeTable::find_slot(const EID &X) const {
+    auto i = slots.find(X);
+    return i == slots.end() ? npos : i->second;
+}
+
+inline std::size_t EdgeTable::slot(const EID &X) {
+    auto [i, inserted] = slots.try_emplace(X, 0);
+    if (inserted) {
+        // Reuse a released slot, if any.
+        if (released.empty()) {
+            i->second = n++;
+        } else {
+            i->second = released.back();
+            released.pop_back();
+        }
+    }
+    return i->second;
+}
+
+inline void EdgeTable::erase(const EID &X) {
+    auto i = slots.find(X);
+    if (i == slots.end()) return;
+    // Reset the values and release the slot.
+    PropertyTable::erase(i->second);
+    released.push_back(i->second);
+    slots.erase(i);
+}
+
+inline void EdgeTable::compact(const std::vector<VID> &remap, std::size_t n) {
+    // Slots are stable, only the edge ids are rekeyed.
+    std::unordered_map<EID, std::size_t, boost::hash<EID>> out;
+    out.reserve(slots.size());
+    for (const auto &[X, i] : slots) {
+        if (remap[X.first] >= n || remap[X.second] >= n) {
+            // Reset the values and release the slot.
+            PropertyTable::erase(i);
+            released.push_back(i);
+        } else {
+            out.emplace(EID(remap[X.first], remap[X.second]), i);
+        }
+    }
+    slots = std::move(out);
+}
+
+inline std::size_t EdgeTable::heap_size() const {
+    return PropertyTable::heap_size() + ::heap_size(slots) + ::heap_size(released);
+}
+
+inline std::size_t EdgeTable::heap_slack() const { return PropertyTable::heap_slack() + ::heap_size(released); }
+
+inline void EdgeTable::shrink_to_fit() {
+    if (!released.empty()) {
+        // Map the used slots to their rank, which is monotonic, and the released ones beyond.
+        std::vector<VID> remap(n, n);
+        for (const auto &[X, i] : slots) remap[i] = 0;
+        std::size_t m = 0;
+        for (VID &i : remap) {
+            if (i == 0) i = m++;
+        }
+        for (auto &[X, i] : slots) i = remap[i];
+        for (auto &[key, c] : columns) c->compact(remap, m);
+        std::vector<std::size_t>().swap(released);
+        n = m;
+    }
+    slots.rehash(0);
+    PropertyTable::shrink_to_fit();
+}
+
+template <typename T>
+VertexProperty<T>::Reference::Reference(Column<T> *c, std::size_t i) : c(c), i(i) {}
+
+template <typename T>
+inline const T &VertexProperty<T>::Reference::get() const {
+    return c->get(i);
+}
+
+template <typename T>
+inline VertexProperty<T>::Reference::operator const T &() const {
+    return get();
+}
+
+template <typename T>
+inline typename VertexProperty<T>::Reference &VertexProperty<T>::Reference::operator=(const T &value) {
+    c->at(i) = value;
+    return *this;
+}
+
+template <typename T>
+inline typename VertexProperty<T>::Reference &VertexProperty<T>::Reference::operator=(const Reference &other) {
+    // Copy the value first, since writing may reallocate the column.
+    return *this = T(other.get());
+}
+
+template <typename T>
+VertexProperty<T>::VertexProperty(const IGraph *G, Column<T> *c) : G(G), c(c) {}
+
+template <typename T>
+inline typename VertexProperty<T>::Reference VertexProperty<T>::operator[](const VID &X) {
+    if (!G->has_vertex(X)) throw NOT_DEFINED(X);
+    return Reference(c, X);
+}
+
+template <typename T>
+inline const T &VertexProperty<T>::operator[](const VID &X) const {
+    if (!G->has_vertex(X)) throw NOT_DEFINED(X);
+    return c->get(X);
+}
+
+template <typename T>
+inline bool VertexProperty<T>::has(const VID &X) const {
+    return c->has(X);
+}
+
+template <typename T>
+ConstVertexProperty<T>::ConstVertexProperty(const Column<T> *c) : c(c) {}
+
+template <typename T>
+inline const T &ConstVertexProperty<T>::operator[](const VID &X) const {
+    return c->get(X);
+}
+
+template <typename T>
+inline bool ConstVertexProperty<T>::has(const VID &X) const {
+    return c->has(X);
+}
+
+template <typename T>
+EdgeProperty<T>::Reference::Reference(EdgeTable *t, Column<T> *c, const EID &X) : t(t), c(c), X(X) {}
+
+template <typename T>
+inline const T &EdgeProperty<T>::Reference::get() const {
+    // A missing slot is out of range, hence it reads the default value.
+    return c->get(t->find_slot(X));
+}
+
+template <typename T>
+inline EdgeProperty<T>::Reference::operator const T &() const {
+    return get();
+}
+
+template <typename T>
+inline typename EdgeProperty<T>::Reference &EdgeProperty<T>::Reference::operator=(const T &value) {
+    c->at(t->slot(X)) = value;
+    return *this;
+}
+
+template <typename T>
+inline typename EdgeProperty<T>::Reference &EdgeProperty<T>::Reference::operator=(const Reference &other) {
+    // Copy the value first, since writing may reallocate the column.
+    return *this = T(other.get());
+}
+
+template <typename T>
+EdgeProperty<T>::EdgeProperty(const IGraph *G, EdgeTable *t, Column<T> *c) : G(G), t(t), c(c) {}
+
+template <typename T>
+inline typename EdgeProperty<T>::Reference EdgeProperty<T>::operator[](const EID &X) {
+    // Slots are allocated on assignment only, and only for existing edges.
+    if (!G->has_edge(X)) throw NOT_DEFINED(X.first, X.second);
+    return Reference(t, c, X);
+}
+
+template <typename T>
+inline const T &EdgeProperty<T>::operator[](const EID &X) const {
+    if (!G->has_edge(X)) throw NOT_DEFINED(X.first, X.second);
+    return c->get(t->find_slot(X));
+}
+
+template <typename T>
+inline bool EdgeProperty<T>::has(const EID &X) const {
+    return c->has(t->find_slot(X));
+}
+
+template <typename T>
+ConstEdgeProperty<T>::ConstEdgeProperty(const EdgeTable *t, const Column<T> *c) : t(t), c(c) {}
+
+template <typename T>
+inline const T &ConstEdgeProperty<T>::operator[](const EID &X) const {
+    // A missing slot is out of range, hence it reads the default value.
+    return c->get(t->find_slot(X));
+}
+
+template <typename T>
+inline bool ConstEdgeProperty<T>::has(const EID &X) const {
+    return c->has(t->find_slot(X));
+}
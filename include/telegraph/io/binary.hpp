@@ -0,0 +1,374 @@
+#pragma once
+
+#include <algorithm>
+#include <any>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "../algorithm/csr.ipp"
+#include "mapped_file.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Adjacency payload of a binary graph file.
+ */
+enum class BinaryLayout {
+    //! The smaller of the two layouts.
+    AUTO,
+    //! Sorted children and parents lists, for sparse graphs.
+    CSR,
+    //! Bit rows with in-degrees and out-degrees, for dense graphs.
+    BIT_MATRIX
+};
+
+/**
+ * @brief Write a graph in the binary format.
+ *
+ * The file is a sequence of 8-byte aligned sections in native byte order:
+ * a versioned header, the bitmap of the vertex ids, the adjacency payload,
+ * the label string tables and one typed column per attribute key, each
+ * column holding its vertex or edge keys in sorted order. Attributes of
+ * type bool, char, integer, floating point or std::string are written,
+ * attributes of other types and graph attributes are not.
+ *
+ * @param G Given graph.
+ * @param out Given output stream, opened in binary mode.
+ * @param layout Given adjacency payload layout.
+ */
+inline void write_binary(const IGraph &G, std::ostream &out, BinaryLayout layout = BinaryLayout::AUTO);
+
+/**
+ * @brief Write a graph in the binary format to a file.
+ *
+ * @param G Given graph.
+ * @param path Given file path.
+ * @param layout Given adjacency payload layout.
+ * @throws std::runtime_error If the file cannot be written.
+ * @see write_binary
+ */
+inline void write_binary(const IGraph &G, const std::string &path, BinaryLayout layout = BinaryLayout::AUTO);
+
+/**
+ * @brief Read-only graph backed by a memory-mapped binary graph file.
+ *
+ * Opening a file maps it and locates its sections, hence it takes constant
+ * time in the number of vertices and edges: adjacency lists, labels and
+ * attributes are read in place, without parsing or copying, and pages are
+ * loaded lazily by the operating system. Copies share the same mapping,
+ * which is released with the last one.
+ *
+ * Section sizes and offsets, vertex ids of targets and keys, and the order
+ * of keys are checked when the file is opened, with a linear pass over each
+ * section, hence a truncated or corrupt file is rejected instead of being
+ * read out of bounds. Attribute values and degrees are trusted.
+ */
+class MappedGraph : public IGraph {
+   protected:
+    //! Position returned by a key search if none.
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    //! Sorted keys of a section, each made of one or two vertex ids.
+    struct Keys {
+        //! Number of keys.
+        std::size_t k;
+        //! Number of vertex ids per key.
+        std::size_t arity;
+        //! Flat key storage.
+        const std::uint64_t *data;
+
+        /**
+         * @brief Find the position of a key.
+         *
+         * @param X Given key, made of *arity* vertex ids.
+         * @return std::size_t Position, npos if none.
+         */
+        inline std::size_t find(const std::uint64_t *X) const;
+    };
+
+    //! Table of strings stored back to back.
+    struct Strings {
+        //! Offset of each string, followed by the total length.
+        const std::uint64_t *offsets;
+        //! Contiguous storage of the strings.
+        const char *bytes;
+
+        //! Get the string at a given position.
+        inline std::string_view operator[](std::size_t i) const;
+    };
+
+    //! Typed attribute column.
+    struct Attribute {
+        //! Value type tag.
+        std::size_t tag;
+        //! Keys with a value.
+        Keys keys;
+        //! Values of scalar types.
+        const char *values;
+        //! Values of string type.
+        Strings strings;
+    };
+
+    //! Mapped file, unmapped with the last copy.
+    MappedFile file;
+    //! Payload layout.
+    BinaryLayout layout;
+    //! Upper bound of the vertex ids.
+    std::size_t n;
+    //! Number of vertices.
+    std::size_t N;
+    //! Number of edges.
+    std::size_t M;
+    //! Hash of the written graph.
+    std::size_t h;
+    //! Number of words per bit row.
+    std::size_t w;
+    //! Bitmap of the vertex ids.
+    const std::uint64_t *present;
+    //! Offsets of the children and of the parents, for the CSR layout.
+    const std::uint64_t *offsets[2];
+    //! Sorted children and parents, for the CSR layout.
+    const std::uint64_t *targets[2];
+    //! Bit rows, for the bit matrix layout.
+    const std::uint64_t *rows;
+    //! In-degrees and out-degrees, for the bit matrix layout.
+    const std::uint64_t *degrees[2];
+    //! Whether the graph has a label.
+    bool labeled;
+    //! Graph label.
+    std::string_view glb;
+    //! Vertices with a label.
+    Keys vkeys;
+    //! Vertex labels.
+    Strings vlbs;
+    //! Edges with a label.
+    Keys ekeys;
+    //! Edge labels.
+    Strings elbs;
+    //! Vertex attribute columns, indexed by key.
+    std::map<std::string, Attribute> vattrs;
+    //! Edge attribute columns, indexed by key.
+    std::map<std::string, Attribute> eattrs;
+
+    /**
+     * @brief Read an attribute value.
+     *
+     * @tparam T Attribute value type.
+     * @param columns Given attribute columns.
+     * @param X Given key.
+     * @param key Given attribute key.
+     * @return T Attribute value.
+     * @throws std::invalid_argument If the key has no value.
+     * @throws std::bad_any_cast If the attribute is of a different type.
+     */
+    template <typename T>
+    inline T read_attr(const std::map<std::string, Attribute> &columns, const std::uint64_t *X,
+                       const std::string &key) const;
+
+    inline virtual bool next_vertex(std::size_t &i, VID &Y) const override;
+
+    inline virtual bool next_child(const VID &X, std::size_t &i, VID &Y) const override;
+
+    inline virtual bool next_parent(const VID &X, std::size_t &i, VID &Y) const override;
+
+    inline virtual std::size_t hash() const override;
+
+   public:
+    /**
+     * @brief Open a binary graph file.
+     *
+     * @param path Given file path.
+     * @throws std::runtime_error If the file cannot be mapped or is not a valid graph file.
+     */
+    explicit MappedGraph(const std::string &path);
+
+    MappedGraph(const MappedGraph &other) = default;
+
+    MappedGraph &operator=(const MappedGraph &other) = default;
+
+    virtual ~MappedGraph();
+
+    inline virtual operator AdjacencyList() const override;
+
+    inline virtual operator AdjacencyMatrix() const override;
+
+    inline virtual operator SparseAdjacencyMatrix() const override;
+
+    inline virtual std::size_t order() const override;
+
+    inline virtual std::size_t size() const override;
+
+    /**
+     * @brief Memory used by the graph.
+     *
+     * The adjacency, labels and attribute values are read in place, hence
+     * they are accounted as mapped bytes, and only the attribute columns
+     * index is allocated on the heap.
+     *
+     * @return MemoryUsage Memory usage, in bytes.
+     */
+    inline virtual MemoryUsage memory_usage() const override;
+
+    //! Nothing to release, the graph is read in place.
+    inline virtual void shrink_to_fit() override;
+
+    //! Payload layout of the file.
+    inline BinaryLayout get_layout() const;
+
+    inline virtual bool has_vertex(const VID &X) const override;
+
+    //! Throws std::logic_error, the graph is read-only.
+    inline virtual VID add_vertex() override;
+
+    //! Throws std::logic_error, the graph is read-only.
+    inline virtual void add_vertex(const VID &X) override;
+
+    //! Throws std::logic_error, the graph is read-only.
+    inline virtual void del_vertex(const VID &X) override;
+
+    inline virtual std::size_t in_degree(const VID &X) const override;
+
+    inline virtual std::size_t out_degree(const VID &X) const override;
+
+    inline virtual bool has_edge(const EID &X) const override;
+
+    //! Throws std::logic_error, the graph is read-only.
+    inline virtual void add_edge(const EID &X) override;
+
+    //! Throws std::logic_error, the graph is read-only.
+    inline virtual void del_edge(const EID &X) override;
+
+    /**
+     * @brief Check if the graph has a label.
+     *
+     * @return true If the graph has a label,
+     * @return false Otherwise.
+     */
+    inline bool has_label() const;
+
+    /**
+     * @brief Get the graph label.
+     *
+     * @return std::string_view The graph label, valid as long as the file is mapped.
+     * @throws NO_LABEL If the graph has no label.
+     */
+    inline std::string_view get_label() const;
+
+    /**
+     * @brief Check if a vertex has a label.
+     *
+     * @param X Given vertex id.
+     * @return true If the vertex has a label,
+     * @return false Otherwise.
+     * @throws NOT_DEFINED If the vertex is not defined.
+     */
+    inline bool has_label(const VID &X) const;
+
+    /**
+     * @brief Get the vertex label.
+     *
+     * @param X Given vertex id.
+     * @return std::string_view The vertex label, valid as long as the file is mapped.
+     * @throws NOT_DEFINED If the vertex is not defined.
+     * @throws NO_LABEL If the vertex has no label.
+     */
+    inline std::string_view get_label(const VID &X) const;
+
+    /**
+     * @brief Check if an edge has a label.
+     *
+     * @param X Given edge id.
+     * @return true If the edge has a label,
+     * @return false Otherwise.
+     * @throws NOT_DEFINED If the edge is not defined.
+     */
+    inline bool has_label(const EID &X) const;
+
+    /**
+     * @brief Get the edge label.
+     *
+     * @param X Given edge id.
+     * @return std::string_view The edge label, valid as long as the file is mapped.
+     * @throws NOT_DEFINED If the edge is not defined.
+     * @throws NO_LABEL If the edge has no label.
+     */
+    inline std::string_view get_label(const EID &X) const;
+
+    /**
+     * @brief Check if a vertex has an attribute.
+     *
+     * @param X Given vertex id.
+     * @param key Given attribute key.
+     * @return true If the vertex has a value for the key,
+     * @return false Otherwise.
+     * @throws NOT_DEFINED If the vertex is not defined.
+     */
+    inline bool has_attr(const VID &X, const std::string &key) const;
+
+    /**
+     * @brief Get a vertex attribute.
+     *
+     * @tparam T Attribute value type, the same as when written.
+     * @param X Given vertex id.
+     * @param key Given attribute key.
+     * @return T Attribute value.
+     * @throws NOT_DEFINED If the vertex is not defined.
+     * @throws std::invalid_argument If the vertex has no value for the key.
+     * @throws std::bad_any_cast If the attribute is of a different type.
+     */
+    template <typename T>
+    inline T get_attr(const VID &X, const std::string &key) const;
+
+    /**
+     * @brief Check if an edge has an attribute.
+     *
+     * @param X Given edge id.
+     * @param key Given attribute key.
+     * @return true If the edge has a value for the key,
+     * @return false Otherwise.
+     * @throws NOT_DEFINED If the edge is not defined.
+     */
+    inline bool has_attr(const EID &X, const std::string &key) const;
+
+    /**
+     * @brief Get an edge attribute.
+     *
+     * @tparam T Attribute value type, the same as when written.
+     * @param X Given edge id.
+     * @param key Given attribute key.
+     * @return T Attribute value.
+     * @throws NOT_DEFINED If the edge is not defined.
+     * @throws std::invalid_argument If the edge has no value for the key.
+     * @throws std::bad_any_cast If the attribute is of a different type.
+     */
+    template <typename T>
+    inline T get_attr(const EID &X, const std::string &key) const;
+
+    /**
+     * @brief Get the keys of the vertex attributes.
+     *
+     * @return std::vector<std::string> Attribute keys, in sorted order.
+     */
+    inline std::vector<std::string> vertex_property_keys() const;
+
+    /**
+     * @brief Get the keys of the edge attributes.
+     *
+     * @return std::vector<std::string> Attribute keys, in sorted order.
+     */
+    inline std::vector<std::string> edge_property_keys() const;
+
+   private:
+    inline virtual void print(std::ostream &out) const override;
+};
+
+}  // namespace telegraph
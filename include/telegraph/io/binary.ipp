@@ -0,0 +1,740 @@
+#pragma once
+
+#include "binary.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+static_assert(sizeof(VID) == sizeof(std::uint64_t) && sizeof(std::size_t) == sizeof(std::uint64_t),
+              "The binary format requires 64-bit vertex ids and sizes.");
+
+//! Attribute value types of the binary format, identified by their position.
+using BinaryTypes = std::tuple<bool, char, signed char, unsigned char, short, unsigned short, int, unsigned, long,
+                               unsigned long, long long, unsigned long long, float, double, std::string>;
+
+//! Type tag of the types outside the binary format.
+static constexpr std::size_t NO_TAG = std::tuple_size_v<BinaryTypes>;
+//! First bytes of a binary graph file.
+static constexpr char BINARY_MAGIC[8] = {'T', 'G', 'R', 'A', 'P', 'H', 'B', 'F'};
+//! Version of the binary format.
+static constexpr std::uint32_t BINARY_VERSION = 1;
+//! Byte order mark, read back swapped on hosts of the other endianness.
+static constexpr std::uint32_t BINARY_MARK = 0x01020304;
+
+/**
+ * @brief Header of a binary graph file.
+ */
+struct BinaryHeader {
+    //! Magic bytes.
+    char magic[8];
+    //! Format version.
+    std::uint32_t version;
+    //! Byte order mark.
+    std::uint32_t mark;
+    //! Payload layout.
+    std::uint64_t layout;
+    //! Upper bound of the vertex ids.
+    std::uint64_t bound;
+    //! Number of vertices.
+    std::uint64_t order;
+    //! Number of edges.
+    std::uint64_t size;
+    //! Hash of the graph.
+    std::uint64_t hash;
+};
+
+//! Type tag of a value type, NO_TAG if outside the binary format.
+template <typename T, std::size_t I = 0>
+constexpr std::size_t binary_tag() {
+    if constexpr (I == NO_TAG) {
+        return NO_TAG;
+    } else if constexpr (std::is_same_v<T, std::tuple_element_t<I, BinaryTypes>>) {
+        return I;
+    } else {
+        return binary_tag<T, I + 1>();
+    }
+}
+
+//! Type tag of a runtime value type, NO_TAG if outside the binary format.
+template <std::size_t... I>
+inline std::size_t binary_tag(const std::type_info &type, std::index_sequence<I...>) {
+    std::size_t out = NO_TAG;
+    ((type == typeid(std::tuple_element_t<I, BinaryTypes>) ? (out = I, true) : false) || ...);
+    return out;
+}
+
+//! Call a function with a default value of the type of a given tag.
+template <typename F, std::size_t... I>
+inline void binary_visit(std::size_t tag, const F &f, std::index_sequence<I...>) {
+    ((tag == I ? (f(std::tuple_element_t<I, BinaryTypes>()), true) : false) || ...);
+}
+
+//! Sequence of the type tags.
+using BinaryTags = std::make_index_sequence<NO_TAG>;
+
+/**
+ * @brief Writer of 8-byte aligned sections.
+ */
+struct BinaryWriter {
+    //! Output stream.
+    std::ostream &out;
+
+    //! Write a single word.
+    inline void word(std::uint64_t x) { out.write(reinterpret_cast<const char *>(&x), sizeof(x)); }
+
+    //! Write an array, padded to a multiple of 8 bytes.
+    template <typename T>
+    inline void array(const T *p, std::size_t k) {
+        static constexpr char zeros[8] = {0};
+        out.write(reinterpret_cast<const char *>(p), k * sizeof(T));
+        out.write(zeros, (8 - k * sizeof(T) % 8) % 8);
+    }
+
+    //! Write a string, prefixed by its length.
+    inline void string(std::string_view s) {
+        word(s.size());
+        array(s.data(), s.size());
+    }
+
+    //! Write a table of strings.
+    inline void strings(const std::vector<std::string> &S) {
+        std::vector<std::uint64_t> offsets(S.size() + 1, 0);
+        for (std::size_t i = 0; i < S.size(); i++) offsets[i + 1] = offsets[i] + S[i].size();
+        array(offsets.data(), offsets.size());
+        std::string bytes;
+        bytes.reserve(offsets.back());
+        for (const std::string &s : S) bytes += s;
+        array(bytes.data(), bytes.size());
+    }
+
+    //! Write a keyed section, keys as one or two vertex ids each.
+    inline void keys(const std::vector<std::uint64_t> &K, std::size_t arity) {
+        word(K.size() / arity);
+        array(K.data(), K.size());
+    }
+};
+
+/**
+ * @brief Reader of 8-byte aligned sections, checking their sizes.
+ */
+struct BinaryReader {
+    //! Current position.
+    const char *p;
+    //! End of the file.
+    const char *end;
+    //! File path, for error messages.
+    const std::string &path;
+
+    //! Read an array, padded to a multiple of 8 bytes.
+    template <typename T>
+    inline const T *array(std::size_t k) {
+        const std::size_t left = end - p;
+        if (k > left / sizeof(T) || (k * sizeof(T) + 7) / 8 * 8 > left) throw INVALID_FILE(path);
+        const T *out = reinterpret_cast<const T *>(p);
+        p += (k * sizeof(T) + 7) / 8 * 8;
+        return out;
+    }
+
+    //! Read a single word.
+    inline std::uint64_t word() { return *array<std::uint64_t>(1); }
+
+    //! Read a string, prefixed by its length.
+    inline std::string_view string() {
+        const std::size_t k = word();
+        return std::string_view(array<char>(k), k);
+    }
+
+    //! Read the number of keys of a keyed section.
+    inline std::size_t count() {
+        const std::size_t k = word();
+        if (k > std::size_t(end - p)) throw INVALID_FILE(path);
+        return k;
+    }
+};
+
+//! Sorted edges of a graph, as flat pairs of vertex ids.
+inline std::vector<std::uint64_t> flat_edges(const CSR &C) {
+    std::vector<std::uint64_t> out;
+    out.reserve(2 * C.nonzeros());
+    for (VID X = 0; X < C.rows(); X++) {
+        for (std::size_t j = C.offsets[X]; j < C.offsets[X + 1]; j++) {
+            out.push_back(X);
+            out.push_back(C.targets[j]);
+        }
+    }
+    return out;
+}
+
+//! Write the labels of the vertices of a graph.
+inline void write_vertex_labels(const AbstractGraph *G, BinaryWriter &out) {
+    std::vector<std::uint64_t> K;
+    std::vector<std::string> S;
+    if (G != nullptr) {
+        for (const VID &X : G->V()) {
+            if (!G->has_label(X)) continue;
+            K.push_back(X);
+            S.push_back(G->get_label(X));
+        }
+    }
+    out.keys(K, 1);
+    out.strings(S);
+}
+
+//! Write the labels of the edges of a graph.
+inline void write_edge_labels(const AbstractGraph *G, const std::vector<std::uint64_t> &E, BinaryWriter &out) {
+    std::vector<std::uint64_t> K;
+    std::vector<std::string> S;
+    if (G != nullptr) {
+        for (std::size_t i = 0; i < E.size(); i += 2) {
+            const EID X(E[i], E[i + 1]);
+            if (!G->has_label(X)) continue;
+            K.push_back(X.first);
+            K.push_back(X.second);
+            S.push_back(G->get_label(X));
+        }
+    }
+    out.keys(K, 2);
+    out.strings(S);
+}
+
+//! Write the values of an attribute column.
+template <typename T>
+inline void write_values(const std::vector<T> &values, BinaryWriter &out) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        out.strings(values);
+    } else {
+        // Copy through bytes, std::vector<bool> is not contiguous.
+        std::vector<char> bytes(values.size() * sizeof(T));
+        for (std::size_t i = 0; i < values.size(); i++) {
+            const T value = values[i];
+            std::memcpy(bytes.data() + i * sizeof(T), &value, sizeof(T));
+        }
+        out.array(bytes.data(), bytes.size());
+    }
+}
+
+//! Write the vertex attribute columns of a graph.
+inline void write_vertex_attrs(const AbstractGraph *G, BinaryWriter &out) {
+    std::vector<std::pair<std::string, std::size_t>> columns;
+    if (G != nullptr) {
+        for (const std::string &key : G->vertex_property_keys()) {
+            const std::size_t tag = binary_tag(G->vertex_property_type(key), BinaryTags());
+            if (tag != NO_TAG) columns.emplace_back(key, tag);
+        }
+    }
+    out.word(columns.size());
+    for (const auto &[key, tag] : columns) {
+        out.string(key);
+        out.word(tag);
+        binary_visit(
+            tag,
+            [&, &key = key](auto none) {
+                using T = decltype(none);
+                const ConstVertexProperty<T> P = G->vertex_property<T>(key);
+                std::vector<std::uint64_t> K;
+                std::vector<T> values;
+                for (const VID &X : G->V()) {
+                    if (!P.has(X)) continue;
+                    K.push_back(X);
+                    values.push_back(P[X]);
+                }
+                out.keys(K, 1);
+                write_values(values, out);
+            },
+            BinaryTags());
+    }
+}
+
+//! Write the edge attribute columns of a graph.
+inline void write_edge_attrs(const AbstractGraph *G, const std::vector<std::uint64_t> &E, BinaryWriter &out) {
+    std::vector<std::pair<std::string, std::size_t>> columns;
+    if (G != nullptr) {
+        for (const std::string &key : G->edge_property_keys()) {
+            const std::size_t tag = binary_tag(G->edge_property_type(key), BinaryTags());
+            if (tag != NO_TAG) columns.emplace_back(key, tag);
+        }
+    }
+    out.word(columns.size());
+    for (const auto &[key, tag] : columns) {
+        out.string(key);
+        out.word(tag);
+        binary_visit(
+            tag,
+            [&, &key = key](auto none) {
+                using T = decltype(none);
+                const ConstEdgeProperty<T> P = G->edge_property<T>(key);
+                std::vector<std::uint64_t> K;
+                std::vector<T> values;
+                for (std::size_t i = 0; i < E.size(); i += 2) {
+                    const EID X(E[i], E[i + 1]);
+                    if (!P.has(X)) continue;
+                    K.push_back(X.first);
+                    K.push_back(X.second);
+                    values.push_back(P[X]);
+                }
+                out.keys(K, 2);
+                write_values(values, out);
+            },
+            BinaryTags());
+    }
+}
+
+}  // namespace detail
+
+inline void write_binary(const IGraph &G, std::ostream &out, BinaryLayout layout) {
+    // Snapshot the children with sorted rows, and the parents.
+    CSR C(G);
+    parallel_for(C.rows(), detail::CSR_GRAIN, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (VID X = b; X < e; X++) std::sort(C.targets.begin() + C.offsets[X], C.targets.begin() + C.offsets[X + 1]);
+    });
+    const CSR T = C.transpose();
+    const std::size_t n = C.rows(), w = (n + 63) / 64;
+    // Pick the smaller payload.
+    if (layout == BinaryLayout::AUTO) {
+        const bool dense = n * w + 2 * n < 2 * (n + 1) + 2 * C.nonzeros();
+        layout = dense ? BinaryLayout::BIT_MATRIX : BinaryLayout::CSR;
+    }
+    detail::BinaryWriter writer{out};
+    // Write the header.
+    detail::BinaryHeader header;
+    std::memcpy(header.magic, detail::BINARY_MAGIC, sizeof(header.magic));
+    header.version = detail::BINARY_VERSION;
+    header.mark = detail::BINARY_MARK;
+    header.layout = static_cast<std::uint64_t>(layout);
+    header.bound = n;
+    header.order = G.order();
+    header.size = G.size();
+    header.hash = std::hash<IGraph>()(G);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    // Write the bitmap of the vertex ids.
+    std::vector<std::uint64_t> words(w, 0);
+    for (const VID &X : G.V()) words[X / 64] |= std::uint64_t(1) << (X % 64);
+    writer.array(words.data(), w);
+    // Write the adjacency payload.
+    if (layout == BinaryLayout::CSR) {
+        writer.array(C.offsets.data(), n + 1);
+        writer.array(C.targets.data(), C.nonzeros());
+        writer.array(T.offsets.data(), n + 1);
+        writer.array(T.targets.data(), T.nonzeros());
+    } else {
+        for (VID X = 0; X < n; X++) {
+            std::fill(words.begin(), words.end(), 0);
+            for (std::size_t j = C.offsets[X]; j < C.offsets[X + 1]; j++) {
+                words[C.targets[j] / 64] |= std::uint64_t(1) << (C.targets[j] % 64);
+            }
+            writer.array(words.data(), w);
+        }
+        for (VID X = 0; X < n; X++) writer.word(T.offsets[X + 1] - T.offsets[X]);
+        for (VID X = 0; X < n; X++) writer.word(C.offsets[X + 1] - C.offsets[X]);
+    }
+    // Write the labels and the attributes.
+    const auto *A = dynamic_cast<const AbstractGraph *>(&G);
+    const std::vector<std::uint64_t> E = detail::flat_edges(C);
+    const bool labeled = A != nullptr && A->has_label();
+    writer.word(labeled);
+    writer.string(labeled ? A->get_label() : GLB());
+    detail::write_vertex_labels(A, writer);
+    detail::write_edge_labels(A, E, writer);
+    detail::write_vertex_attrs(A, writer);
+    detail::write_edge_attrs(A, E, writer);
+}
+
+inline void write_binary(const IGraph &G, const std::string &path, BinaryLayout layout) {
+    // Write through a large buffer, set before opening the file.
+    std::vector<char> buffer(1 << 20);
+    std::ofstream out;
+    out.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+    out.open(path, std::ios::binary | std::ios::trunc);
+    if (!out) throw IO_ERROR(path);
+    write_binary(G, out, layout);
+    out.close();
+    if (!out) throw IO_ERROR(path);
+}
+
+inline std::size_t MappedGraph::Keys::find(const std::uint64_t *X) const {
+    // Binary search over the keys in lexicographic order.
+    std::size_t lo = 0, hi = k;
+    while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        const std::uint64_t *Y = data + mid * arity;
+        if (std::lexicographical_compare(Y, Y + arity, X, X + arity)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < k && std::equal(X, X + arity, data + lo * arity)) return lo;
+    return npos;
+}
+
+inline std::string_view MappedGraph::Strings::operator[](std::size_t i) const {
+    return std::string_view(bytes + offsets[i], offsets[i + 1] - offsets[i]);
+}
+
+MappedGraph::MappedGraph(const std::string &path) : file(path) {
+    // Check the header.
+    const std::size_t bytes = file.size();
+    detail::BinaryReader in{file.data(), file.data() + bytes, path};
+    const auto *header = in.array<detail::BinaryHeader>(1);
+    if (std::memcmp(header->magic, detail::BINARY_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != detail::BINARY_VERSION || header->mark != detail::BINARY_MARK ||
+        header->layout == static_cast<std::uint64_t>(BinaryLayout::AUTO) ||
+        header->layout > static_cast<std::uint64_t>(BinaryLayout::BIT_MATRIX)) {
+        throw INVALID_FILE(path);
+    }
+    layout = static_cast<BinaryLayout>(header->layout);
+    n = header->bound;
+    N = header->order;
+    M = header->size;
+    h = header->hash;
+    if (n > bytes) throw INVALID_FILE(path);
+    w = (n + 63) / 64;
+    // Locate the sections.
+    present = in.array<std::uint64_t>(w);
+    offsets[0] = offsets[1] = targets[0] = targets[1] = rows = degrees[0] = degrees[1] = nullptr;
+    if (layout == BinaryLayout::CSR) {
+        for (std::size_t k = 0; k < 2; k++) {
+            offsets[k] = in.array<std::uint64_t>(n + 1);
+            if (offsets[k][0] != 0 || offsets[k][n] != M) throw INVALID_FILE(path);
+            targets[k] = in.array<std::uint64_t>(M);
+            // Check that the offsets increase and the targets are sorted vertex ids.
+            for (std::size_t X = 0; X < n; X++) {
+                const std::uint64_t first = offsets[k][X], last = offsets[k][X + 1];
+                if (first > last || last > M) throw INVALID_FILE(path);
+                for (std::uint64_t j = first; j < last; j++) {
+                    if (targets[k][j] >= n || (j > first && targets[k][j] <= targets[k][j - 1])) {
+                        throw INVALID_FILE(path);
+                    }
+                }
+            }
+        }
+    } else {
+        if (w > 0 && n > bytes / w) throw INVALID_FILE(path);
+        rows = in.array<std::uint64_t>(n * w);
+        // Check that the padding bits past the last column are clear.
+        for (std::size_t X = 0; n % 64 != 0 && X < n; X++) {
+            if (rows[X * w + w - 1] >> (n % 64) != 0) throw INVALID_FILE(path);
+        }
+        degrees[0] = in.array<std::uint64_t>(n);
+        degrees[1] = in.array<std::uint64_t>(n);
+    }
+    auto read_keys = [&](std::size_t arity) -> Keys {
+        const std::size_t k = in.count();
+        const std::uint64_t *data = in.array<std::uint64_t>(k * arity);
+        // Check that the keys are sorted vertex ids.
+        for (std::size_t i = 0; i < k * arity; i++) {
+            if (data[i] >= n) throw INVALID_FILE(path);
+        }
+        for (std::size_t i = 1; i < k; i++) {
+            const std::uint64_t *X = data + (i - 1) * arity, *Y = X + arity;
+            if (!std::lexicographical_compare(X, Y, Y, Y + arity)) throw INVALID_FILE(path);
+        }
+        return {k, arity, data};
+    };
+    auto read_strings = [&](std::size_t k) -> Strings {
+        const std::uint64_t *offsets = in.array<std::uint64_t>(k + 1);
+        // Check that the offsets increase, the last one being the byte count.
+        if (offsets[0] != 0) throw INVALID_FILE(path);
+        for (std::size_t i = 0; i < k; i++) {
+            if (offsets[i] > offsets[i + 1]) throw INVALID_FILE(path);
+        }
+        return {offsets, in.array<char>(offsets[k])};
+    };
+    auto read_attrs = [&](std::size_t arity, std::map<std::string, Attribute> &out) {
+        const std::size_t k = in.count();
+        for (std::size_t i = 0; i < k; i++) {
+            Attribute &A = out[std::string(in.string())];
+            A.tag = in.word();
+            if (A.tag >= detail::NO_TAG) throw INVALID_FILE(path);
+            A.keys = read_keys(arity);
+            A.values = nullptr;
+            A.strings = {nullptr, nullptr};
+            detail::binary_visit(
+                A.tag,
+                [&](auto none) {
+                    using T = decltype(none);
+                    if constexpr (std::is_same_v<T, std::string>) {
+                        A.strings = read_strings(A.keys.k);
+                    } else {
+                        A.values = in.array<char>(A.keys.k * sizeof(T));
+                    }
+                },
+                detail::BinaryTags());
+        }
+    };
+    labeled = in.word();
+    glb = in.string();
+    vkeys = read_keys(1);
+    vlbs = read_strings(vkeys.k);
+    ekeys = read_keys(2);
+    elbs = read_strings(ekeys.k);
+    read_attrs(1, vattrs);
+    read_attrs(2, eattrs);
+    if (in.p != in.end) throw INVALID_FILE(path);
+}
+
+MappedGraph::~MappedGraph() {}
+
+inline MappedGraph::operator AdjacencyList() const {
+    TELEGRAPH_PROBE(TO_ADJACENCY_LIST);
+    AdjacencyList out;
+    for (const VID &X : V()) {
+        for (const VID &Y : Ch(X)) out[X].insert(Y);
+    }
+    return out;
+}
+
+inline MappedGraph::operator AdjacencyMatrix() const {
+    TELEGRAPH_PROBE(TO_ADJACENCY_MATRIX);
+    // Allocate a squared zero matrix.
+    AdjacencyMatrix out = AdjacencyMatrix::Zero(n, n);
+    // Set the edges.
+    for (const VID &X : V()) {
+        for (const VID &Y : Ch(X)) out(X, Y) = 1;
+    }
+    return out;
+}
+
+inline MappedGraph::operator SparseAdjacencyMatrix() const {
+    TELEGRAPH_PROBE(TO_SPARSE_ADJACENCY_MATRIX);
+    SparseAdjacencyMatrix out(n, n);
+    // Reserve the exact number of non-zeros per row.
+    Eigen::VectorXi nnz(n);
+    for (std::size_t i = 0; i < n; i++) nnz(i) = has_vertex(i) ? out_degree(i) : 0;
+    out.reserve(nnz);
+    // Children are sorted in both layouts, hence insert them in storage order.
+    for (const VID &X : V()) {
+        for (const VID &Y : Ch(X)) out.insert(X, Y) = 1;
+    }
+    out.makeCompressed();
+    return out;
+}
+
+inline std::size_t MappedGraph::order() const { return N; }
+
+inline std::size_t MappedGraph::size() const { return M; }
+
+inline MemoryUsage MappedGraph::memory_usage() const {
+    MemoryUsage out;
+    out.mapped = file.size();
+    // Nodes of the attribute columns index, the columns themselves are mapped.
+    const std::size_t node = NODE_OVERHEAD + sizeof(std::pair<const std::string, Attribute>);
+    out.vertex_attributes = vattrs.size() * node;
+    for (const auto &[key, column] : vattrs) out.vertex_attributes += heap_size(key);
+    out.edge_attributes = eattrs.size() * node;
+    for (const auto &[key, column] : eattrs) out.edge_attributes += heap_size(key);
+    return out;
+}
+
+inline void MappedGraph::shrink_to_fit() {}
+
+inline BinaryLayout MappedGraph::get_layout() const { return layout; }
+
+inline bool MappedGraph::has_vertex(const VID &X) const { return X < n && (present[X / 64] >> (X % 64) & 1); }
+
+inline VID MappedGraph::add_vertex() { throw READ_ONLY; }
+
+inline void MappedGraph::add_vertex(const VID &) { throw READ_ONLY; }
+
+inline void MappedGraph::del_vertex(const VID &) { throw READ_ONLY; }
+
+inline std::size_t MappedGraph::in_degree(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
+    if (layout == BinaryLayout::CSR) return offsets[1][X + 1] - offsets[1][X];
+    return degrees[0][X];
+}
+
+inline std::size_t MappedGraph::out_degree(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
+    if (layout == BinaryLayout::CSR) return offsets[0][X + 1] - offsets[0][X];
+    return degrees[1][X];
+}
+
+inline bool MappedGraph::has_edge(const EID &X) const {
+    TELEGRAPH_PROBE(HAS_EDGE);
+    // Check if X is a valid edge.
+    if (!has_vertex(X.first) || !has_vertex(X.second)) throw NOT_DEFINED(X.first, X.second);
+    if (layout == BinaryLayout::BIT_MATRIX) return rows[X.first * w + X.second / 64] >> (X.second % 64) & 1;
+    // Search the sorted children.
+    const std::uint64_t *first = targets[0] + offsets[0][X.first], *last = targets[0] + offsets[0][X.first + 1];
+    return std::binary_search(first, last, X.second);
+}
+
+inline void MappedGraph::add_edge(const EID &) { throw READ_ONLY; }
+
+inline void MappedGraph::del_edge(const EID &) { throw READ_ONLY; }
+
+inline bool MappedGraph::has_label() const { return labeled; }
+
+inline std::string_view MappedGraph::get_label() const {
+    if (!has_label()) throw NO_LABEL();
+    return glb;
+}
+
+inline bool MappedGraph::has_label(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
+    const std::uint64_t K[1] = {X};
+    return vkeys.find(K) != npos;
+}
+
+inline std::string_view MappedGraph::get_label(const VID &X) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
+    const std::uint64_t K[1] = {X};
+    const std::size_t i = vkeys.find(K);
+    if (i == npos) throw NO_LABEL(X);  // Check if X has a defined label.
+    return vlbs[i];
+}
+
+inline bool MappedGraph::has_label(const EID &X) const {
+    if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);  // Check if X is a valid edge.
+    const std::uint64_t K[2] = {X.first, X.second};
+    return ekeys.find(K) != npos;
+}
+
+inline std::string_view MappedGraph::get_label(const EID &X) const {
+    if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);  // Check if X is a valid edge.
+    const std::uint64_t K[2] = {X.first, X.second};
+    const std::size_t i = ekeys.find(K);
+    if (i == npos) throw NO_LABEL(X.first, X.second);  // Check if X has a defined label.
+    return elbs[i];
+}
+
+template <typename T>
+inline T MappedGraph::read_attr(const std::map<std::string, Attribute> &columns, const std::uint64_t *X,
+                                const std::string &key) const {
+    auto c = columns.find(key);
+    if (c == columns.end()) throw NO_KEY(key);  // Check if key is valid.
+    const Attribute &A = c->second;
+    // Check that the key is bound to the requested type.
+    if (A.tag != detail::binary_tag<T>()) throw std::bad_any_cast();
+    const std::size_t i = A.keys.find(X);
+    if (i == npos) throw NO_KEY(key);  // Check if X has a value.
+    if constexpr (std::is_same_v<T, std::string>) {
+        return std::string(A.strings[i]);
+    } else {
+        T out;
+        std::memcpy(&out, A.values + i * sizeof(T), sizeof(T));
+        return out;
+    }
+}
+
+inline bool MappedGraph::has_attr(const VID &X, const std::string &key) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
+    auto c = vattrs.find(key);
+    const std::uint64_t K[1] = {X};
+    return c != vattrs.end() && c->second.keys.find(K) != npos;
+}
+
+template <typename T>
+inline T MappedGraph::get_attr(const VID &X, const std::string &key) const {
+    if (!has_vertex(X)) throw NOT_DEFINED(X);  // Check if X is a valid vertex.
+    const std::uint64_t K[1] = {X};
+    return read_attr<T>(vattrs, K, key);
+}
+
+inline bool MappedGraph::has_attr(const EID &X, const std::string &key) const {
+    if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);  // Check if X is a valid edge.
+    auto c = eattrs.find(key);
+    const std::uint64_t K[2] = {X.first, X.second};
+    return c != eattrs.end() && c->second.keys.find(K) != npos;
+}
+
+template <typename T>
+inline T MappedGraph::get_attr(const EID &X, const std::string &key) const {
+    if (!has_edge(X)) throw NOT_DEFINED(X.first, X.second);  // Check if X is a valid edge.
+    const std::uint64_t K[2] = {X.first, X.second};
+    return read_attr<T>(eattrs, K, key);
+}
+
+inline std::vector<std::string> MappedGraph::vertex_property_keys() const {
+    std::vector<std::string> out;
+    for (const auto &c : vattrs) out.push_back(c.first);
+    return out;
+}
+
+inline std::vector<std::string> MappedGraph::edge_property_keys() const {
+    std::vector<std::string> out;
+    for (const auto &c : eattrs) out.push_back(c.first);
+    return out;
+}
+
+inline bool MappedGraph::next_vertex(std::size_t &i, VID &Y) const {
+    // Skip the missing vertex ids, a word at a time.
+    while (i < n) {
+        const std::uint64_t word = present[i / 64] >> (i % 64);
+        if (word == 0) {
+            i = (i / 64 + 1) * 64;
+            continue;
+        }
+        Y = i + __builtin_ctzll(word);
+        if (Y >= n) return false;
+        i = Y + 1;
+        return true;
+    }
+    return false;
+}
+
+inline bool MappedGraph::next_child(const VID &X, std::size_t &i, VID &Y) const {
+    if (layout == BinaryLayout::CSR) {
+        if (offsets[0][X] + i >= offsets[0][X + 1]) return false;
+        Y = targets[0][offsets[0][X] + i++];
+        return true;
+    }
+    // Find the next set column, skipping zero words.
+    const std::uint64_t *row = rows + X * w;
+    while (i < n) {
+        const std::uint64_t word = row[i / 64] >> (i % 64);
+        if (word == 0) {
+            i = (i / 64 + 1) * 64;
+            continue;
+        }
+        Y = i + __builtin_ctzll(word);
+        i = Y + 1;
+        return true;
+    }
+    return false;
+}
+
+inline bool MappedGraph::next_parent(const VID &X, std::size_t &i, VID &Y) const {
+    if (layout == BinaryLayout::CSR) {
+        if (offsets[1][X] + i >= offsets[1][X + 1]) return false;
+        Y = targets[1][offsets[1][X] + i++];
+        return true;
+    }
+    // Scan the column of X.
+    for (; i < n; i++) {
+        if (rows[i * w + X / 64] >> (X % 64) & 1) {
+            Y = i++;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline std::size_t MappedGraph::hash() const { return h; }
+
+inline void MappedGraph::print(std::ostream &out) const {
+    // Print graph class.
+    out << "MappedGraph( ";
+
+    // Print vertex set.
+    out << "V = ( ";
+    for (const VID &X : V()) out << X << ", ";
+    // Close vertex set.
+    out << " )";
+
+    // Print edge set.
+    out << ", E = ( ";
+    // Children are sorted in both layouts.
+    for (const VID &X : V()) {
+        for (const VID &Y : Ch(X)) out << "(" << X << ", " << Y << "), ";
+    }
+    // Close edge set.
+    out << " )";
+
+    // Close graph class.
+    out << " )" << std::endl;
+}
+
+}  // namespace telegraph
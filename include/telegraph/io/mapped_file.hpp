@@ -0,0 +1,44 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+
+#include "../interface/exceptions.hpp"
+
+namespace telegraph {
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * Pages are loaded lazily by the operating system and shared with the page
+ * cache. Copies share the same mapping, which is released with the last one.
+ */
+class MappedFile {
+   protected:
+    //! Mapped bytes, nullptr if the file is empty.
+    std::shared_ptr<const char> bytes;
+    //! Number of mapped bytes.
+    std::size_t n;
+
+   public:
+    /**
+     * @brief Map a file.
+     *
+     * @param path Given file path.
+     * @throws std::runtime_error If the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string &path);
+
+    //! Pointer to the first byte.
+    inline const char *data() const;
+
+    //! Number of bytes.
+    inline std::size_t size() const;
+};
+
+}  // namespace telegraph
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "mapped_file.hpp"
+
+namespace telegraph {
+
+MappedFile::MappedFile(const std::string &path) : n(0) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw IO_ERROR(path);
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw IO_ERROR(path);
+    }
+    n = info.st_size;
+    // Empty files cannot be mapped.
+    if (n == 0) {
+        ::close(fd);
+        return;
+    }
+    void *p = ::mmap(nullptr, n, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) throw IO_ERROR(path);
+    const std::size_t k = n;
+    bytes = std::shared_ptr<const char>(static_cast<const char *>(p),
+                                        [k](const char *p) { ::munmap(const_cast<char *>(p), k); });
+}
+
+inline const char *MappedFile::data() const { return bytes.get(); }
+
+inline std::size_t MappedFile::size() const { return n; }
+
+}  // namespace telegraph
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../interface/abstract_graph.ipp"
+#include "../algorithm/utility.ipp"
+#include "mapped_file.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Options of the edge list reader.
+ */
+struct EdgeListOptions {
+    //! Whether vertices are given as labels, mapped to vertex ids in order of first appearance.
+    bool labels = false;
+    //! Vertex id of the first vertex, e.g. one for 1-based files, ignored for labels.
+    VID base = 0;
+    //! Edge attribute key of the numeric third column, if any, empty to ignore the columns after the second one.
+    std::string weight;
+};
+
+/**
+ * @brief Read a graph from an edge list file.
+ *
+ * Each line holds the source and target of an edge, separated by blanks or
+ * commas. Blank lines and lines starting with '#' or '%' are skipped.
+ *
+ * The file is mapped in memory and split into chunks at line boundaries,
+ * then the chunks are parsed in parallel with std::from_chars, and their
+ * edges are passed to the bulk insertion of the container as a single
+ * contiguous sequence. Repeated edges are inserted once.
+ *
+ * @tparam T Graph typename, derived from AbstractGraph.
+ * @param path Given file path.
+ * @param options Given reader options.
+ * @return T Graph with one vertex per id up to the highest one, or per label.
+ * @throws std::runtime_error If the file cannot be read or is malformed.
+ */
+template <typename T>
+inline T read_edge_list(const std::string &path, const EdgeListOptions &options = EdgeListOptions());
+
+/**
+ * @brief Read a graph from a MatrixMarket coordinate file.
+ *
+ * Each entry is an edge from its row to its column, 1-based. Entries of
+ * symmetric, skew-symmetric and hermitian matrices are mirrored. Values of
+ * real and integer matrices are set as a numeric edge attribute, negated
+ * on mirrored skew-symmetric entries. Entries are parsed in parallel.
+ *
+ * @tparam T Graph typename, derived from AbstractGraph.
+ * @param path Given file path.
+ * @param key Given edge attribute key of the values, empty to ignore them.
+ * @return T Graph with one vertex per row or column.
+ * @throws std::runtime_error If the file cannot be read, is malformed, or is not a real, integer or pattern
+ * coordinate matrix.
+ */
+template <typename T>
+inline T read_matrix_market(const std::string &path, const std::string &key = "weight");
+
+/**
+ * @brief Read a graph from a DIMACS file.
+ *
+ * The problem line "p <format> <vertices> <edges>" sets the number of
+ * vertices. Arc lines "a <source> <target> [<weight>]" add a directed edge,
+ * while edge lines "e <source> <target> [<weight>]" add both directions,
+ * 1-based. Comment lines start with 'c'. Lines are parsed in parallel.
+ *
+ * @tparam T Graph typename, derived from AbstractGraph.
+ * @param path Given file path.
+ * @param key Given edge attribute key of the weights, empty to ignore them.
+ * @return T Graph with the given number of vertices.
+ * @throws std::runtime_error If the file cannot be read or is malformed.
+ */
+template <typename T>
+inline T read_dimacs(const std::string &path, const std::string &key = "weight");
+
+}  // namespace telegraph
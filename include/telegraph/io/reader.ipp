@@ -0,0 +1,348 @@
+#pragma once
+
+#include "reader.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Minimum number of bytes per parsed chunk.
+static constexpr std::size_t PARSE_GRAIN = 1 << 20;
+//! Weight of the edges without one.
+static constexpr double NO_WEIGHT = std::numeric_limits<double>::quiet_NaN();
+
+/**
+ * @brief Edges parsed from a chunk of a file.
+ */
+struct ParsedChunk {
+    //! Parsed edges, in file order.
+    std::vector<EID> edges;
+    //! Weight of each parsed edge, NO_WEIGHT if none, empty if not parsed.
+    std::vector<double> weights;
+    //! Highest vertex id plus one.
+    std::size_t bound = 0;
+    //! Labels in order of first appearance in the chunk, by local vertex id.
+    std::vector<std::string_view> labels;
+    //! Local vertex id of each label.
+    std::unordered_map<std::string_view, VID> index;
+    //! Offset of the first malformed line, npos if none.
+    std::size_t error = std::string_view::npos;
+};
+
+//! Whether a character separates the tokens of a line.
+inline bool is_blank(char c) { return c == ' ' || c == '\t' || c == '\r' || c == ','; }
+
+//! Skip the separators at the cursor.
+inline void skip_blanks(const char *&p, const char *end) {
+    while (p != end && is_blank(*p)) p++;
+}
+
+//! Whether only separators are left in the line.
+inline bool at_end(const char *&p, const char *end) {
+    skip_blanks(p, end);
+    return p == end;
+}
+
+//! Read the next token of a line, empty if none.
+inline std::string_view read_token(const char *&p, const char *end) {
+    skip_blanks(p, end);
+    const char *q = p;
+    while (p != end && !is_blank(*p)) p++;
+    return std::string_view(q, p - q);
+}
+
+//! Read the next number of a line, false if the token is not a number.
+template <typename N>
+inline bool read_number(const char *&p, const char *end, N &x) {
+    skip_blanks(p, end);
+    const auto [q, ec] = std::from_chars(p, end, x);
+    if (ec != std::errc() || (q != end && !is_blank(*q))) return false;
+    p = q;
+    return true;
+}
+
+//! Read a 1-based vertex id, false if not a number in [1, n].
+inline bool read_vertex(const char *&p, const char *end, std::size_t n, VID &X) {
+    if (!read_number(p, end, X) || X < 1 || X > n) return false;
+    X--;
+    return true;
+}
+
+//! Read an optional weight at the end of a line, false if malformed.
+inline bool read_weight(const char *&p, const char *end, double &w) {
+    w = NO_WEIGHT;
+    if (at_end(p, end)) return true;
+    return read_number(p, end, w) && at_end(p, end);
+}
+
+/**
+ * @brief Parse the lines of a byte range in parallel chunks.
+ *
+ * The range is split at line boundaries into chunks of at least PARSE_GRAIN
+ * bytes, a few per worker thread. Each line is passed to the given function,
+ * without its line terminator, and parsing of a chunk stops at its first
+ * malformed line.
+ *
+ * @tparam F Function typename, callable as f(begin, end, chunk) returning false if the line is malformed.
+ * @param first First byte.
+ * @param last Last byte.
+ * @param f Given function.
+ * @return std::vector<ParsedChunk> Parsed chunks, in file order.
+ */
+template <typename F>
+inline std::vector<ParsedChunk> parse_lines(const char *first, const char *last, const F &f) {
+    const std::size_t size = last - first;
+    const std::size_t k = std::max<std::size_t>(1, std::min(size / PARSE_GRAIN, 4 * concurrency()));
+    // Move each split point past the end of its line.
+    std::vector<const char *> split(k + 1, last);
+    split[0] = first;
+    for (std::size_t c = 1; c < k; c++) {
+        const char *p = std::max(split[c - 1], first + c * (size / k));
+        while (p != last && p != first && *(p - 1) != '\n') p++;
+        split[c] = p;
+    }
+    std::vector<ParsedChunk> out(k);
+    parallel_for(k, 1, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (std::size_t c = b; c < e; c++) {
+            for (const char *p = split[c]; p != split[c + 1];) {
+                const char *q = static_cast<const char *>(std::memchr(p, '\n', split[c + 1] - p));
+                if (q == nullptr) q = split[c + 1];
+                if (!f(p, q, out[c])) {
+                    out[c].error = p - first;
+                    break;
+                }
+                p = q == split[c + 1] ? q : q + 1;
+            }
+        }
+    });
+    return out;
+}
+
+//! Throw at the first malformed line of the parsed chunks, if any.
+inline void check_chunks(const std::vector<ParsedChunk> &chunks, const std::string &path, std::size_t offset) {
+    for (const ParsedChunk &c : chunks) {
+        if (c.error != std::string_view::npos) throw PARSE_ERROR(path, offset + c.error);
+    }
+}
+
+/**
+ * @brief Build a graph from parsed chunks.
+ *
+ * Edges and weights of the chunks are concatenated in parallel into
+ * contiguous sequences, then the edges are passed to the bulk insertion.
+ *
+ * @tparam T Graph typename.
+ * @param n Given number of vertices.
+ * @param chunks Given parsed chunks.
+ * @param key Given edge attribute key of the weights, empty to ignore them.
+ * @return T Parsed graph.
+ */
+template <typename T>
+inline T build_graph(std::size_t n, std::vector<ParsedChunk> &chunks, const std::string &key) {
+    // Concatenate the chunks.
+    std::vector<std::size_t> offsets(chunks.size() + 1, 0);
+    bool weighted = false;
+    for (std::size_t c = 0; c < chunks.size(); c++) {
+        offsets[c + 1] = offsets[c] + chunks[c].edges.size();
+        weighted = weighted || !chunks[c].weights.empty();
+    }
+    weighted = weighted && !key.empty();
+    std::vector<EID> E(offsets.back());
+    std::vector<double> W(weighted ? E.size() : 0);
+    parallel_for(chunks.size(), 1, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (std::size_t c = b; c < e; c++) {
+            std::copy(chunks[c].edges.begin(), chunks[c].edges.end(), E.begin() + offsets[c]);
+            if (weighted) std::copy(chunks[c].weights.begin(), chunks[c].weights.end(), W.begin() + offsets[c]);
+            std::vector<EID>().swap(chunks[c].edges);
+            std::vector<double>().swap(chunks[c].weights);
+        }
+    });
+    T G(n);
+    G.add_edges(E.begin(), E.end());
+    // Set the weights, the last one of repeated edges is kept.
+    if (weighted) {
+        EdgeProperty<double> P = G.template edge_property<double>(key);
+        for (std::size_t i = 0; i < E.size(); i++) {
+            if (!std::isnan(W[i])) P[E[i]] = W[i];
+        }
+    }
+    return G;
+}
+
+//! Whether a line is a comment or blank.
+inline bool is_comment(const char *p, const char *end, const std::string_view &prefixes) {
+    skip_blanks(p, end);
+    return p == end || prefixes.find(*p) != std::string_view::npos;
+}
+
+//! Lowercase copy of a token.
+inline std::string lowercase(std::string_view s) {
+    std::string out(s);
+    std::transform(out.begin(), out.end(), out.begin(), [](unsigned char c) { return std::tolower(c); });
+    return out;
+}
+
+//! Find the end of the line at the cursor.
+inline const char *line_end(const char *p, const char *end) {
+    const char *q = static_cast<const char *>(std::memchr(p, '\n', end - p));
+    return q == nullptr ? end : q;
+}
+
+//! Find the start of the next line.
+inline const char *next_line(const char *p, const char *end) {
+    p = line_end(p, end);
+    return p == end ? end : p + 1;
+}
+
+}  // namespace detail
+
+template <typename T>
+inline T read_edge_list(const std::string &path, const EdgeListOptions &options) {
+    const MappedFile file(path);
+    const char *first = file.data(), *last = first + file.size();
+    const bool weighted = !options.weight.empty();
+    auto chunks = detail::parse_lines(first, last, [&](const char *p, const char *end, detail::ParsedChunk &out) {
+        if (detail::is_comment(p, end, "#%")) return true;
+        VID X, Y;
+        if (options.labels) {
+            // Map the labels to local vertex ids, in order of first appearance.
+            VID *Z[2] = {&X, &Y};
+            for (VID *z : Z) {
+                const std::string_view label = detail::read_token(p, end);
+                if (label.empty()) return false;
+                auto i = out.index.emplace(label, out.labels.size());
+                if (i.second) out.labels.push_back(label);
+                *z = i.first->second;
+            }
+        } else {
+            if (!detail::read_number(p, end, X) || !detail::read_number(p, end, Y)) return false;
+            if (X < options.base || Y < options.base) return false;
+            X -= options.base;
+            Y -= options.base;
+            out.bound = std::max<std::size_t>(out.bound, std::max(X, Y) + 1);
+        }
+        out.edges.emplace_back(X, Y);
+        if (weighted) {
+            double w;
+            if (!detail::read_weight(p, end, w)) return false;
+            out.weights.push_back(w);
+        }
+        return true;
+    });
+    detail::check_chunks(chunks, path, 0);
+    if (!options.labels) {
+        std::size_t n = 0;
+        for (const auto &c : chunks) n = std::max(n, c.bound);
+        return detail::build_graph<T>(n, chunks, options.weight);
+    }
+    // Merge the local labels in chunk order, then remap the local vertex ids in parallel.
+    std::unordered_map<std::string_view, VID> index;
+    std::vector<std::string_view> labels;
+    std::vector<std::vector<VID>> remap(chunks.size());
+    for (std::size_t c = 0; c < chunks.size(); c++) {
+        remap[c].reserve(chunks[c].labels.size());
+        for (const std::string_view &label : chunks[c].labels) {
+            auto i = index.emplace(label, labels.size());
+            if (i.second) labels.push_back(label);
+            remap[c].push_back(i.first->second);
+        }
+        decltype(chunks[c].index)().swap(chunks[c].index);
+    }
+    parallel_for(chunks.size(), 1, [&](std::size_t b, std::size_t e, std::size_t) {
+        for (std::size_t c = b; c < e; c++) {
+            for (EID &X : chunks[c].edges) X = EID(remap[c][X.first], remap[c][X.second]);
+        }
+    });
+    T G = detail::build_graph<T>(labels.size(), chunks, options.weight);
+    for (VID X = 0; X < labels.size(); X++) G.set_label(X, VLB(labels[X]));
+    return G;
+}
+
+template <typename T>
+inline T read_matrix_market(const std::string &path, const std::string &key) {
+    const MappedFile file(path);
+    const char *first = file.data(), *last = first + file.size();
+    // Parse the banner.
+    const char *p = first, *end = detail::line_end(p, last);
+    if (detail::read_token(p, end) != "%%MatrixMarket") throw PARSE_ERROR(path, 0);
+    const std::string object = detail::lowercase(detail::read_token(p, end));
+    const std::string format = detail::lowercase(detail::read_token(p, end));
+    const std::string field = detail::lowercase(detail::read_token(p, end));
+    const std::string symmetry = detail::lowercase(detail::read_token(p, end));
+    if (object != "matrix" || format != "coordinate" ||
+        (field != "real" && field != "integer" && field != "pattern") ||
+        (symmetry != "general" && symmetry != "symmetric" && symmetry != "skew-symmetric" &&
+         symmetry != "hermitian")) {
+        throw PARSE_ERROR(path, 0);
+    }
+    // Skip the comments, then parse the size line.
+    p = detail::next_line(p, last);
+    while (p != last && detail::is_comment(p, detail::line_end(p, last), "%")) p = detail::next_line(p, last);
+    std::size_t rows, cols, nnz;
+    const char *q = p;
+    end = detail::line_end(p, last);
+    if (!detail::read_number(q, end, rows) || !detail::read_number(q, end, cols) ||
+        !detail::read_number(q, end, nnz) || !detail::at_end(q, end)) {
+        throw PARSE_ERROR(path, p - first);
+    }
+    const char *body = detail::next_line(p, last);
+    // Parse the entries.
+    const bool weighted = field != "pattern" && !key.empty();
+    const bool mirrored = symmetry != "general";
+    const double sign = symmetry == "skew-symmetric" ? -1 : 1;
+    auto chunks = detail::parse_lines(body, last, [&](const char *p, const char *end, detail::ParsedChunk &out) {
+        if (detail::is_comment(p, end, "%")) return true;
+        VID X, Y;
+        if (!detail::read_vertex(p, end, rows, X) || !detail::read_vertex(p, end, cols, Y)) return false;
+        double w = detail::NO_WEIGHT;
+        if (field != "pattern" && !detail::read_number(p, end, w)) return false;
+        if (!detail::at_end(p, end)) return false;
+        out.edges.emplace_back(X, Y);
+        if (weighted) out.weights.push_back(w);
+        if (mirrored && X != Y) {
+            out.edges.emplace_back(Y, X);
+            if (weighted) out.weights.push_back(sign * w);
+        }
+        return true;
+    });
+    detail::check_chunks(chunks, path, body - first);
+    return detail::build_graph<T>(std::max(rows, cols), chunks, weighted ? key : std::string());
+}
+
+template <typename T>
+inline T read_dimacs(const std::string &path, const std::string &key) {
+    const MappedFile file(path);
+    const char *first = file.data(), *last = first + file.size();
+    // Skip the comments, then parse the problem line.
+    const char *p = first;
+    while (p != last && detail::is_comment(p, detail::line_end(p, last), "c")) p = detail::next_line(p, last);
+    std::size_t n, m;
+    const char *q = p, *end = detail::line_end(p, last);
+    if (detail::read_token(q, end) != "p" || detail::read_token(q, end).empty() || !detail::read_number(q, end, n) ||
+        !detail::read_number(q, end, m) || !detail::at_end(q, end)) {
+        throw PARSE_ERROR(path, p - first);
+    }
+    const char *body = detail::next_line(p, last);
+    // Parse the arcs and the edges.
+    const bool weighted = !key.empty();
+    auto chunks = detail::parse_lines(body, last, [&](const char *p, const char *end, detail::ParsedChunk &out) {
+        if (detail::is_comment(p, end, "c")) return true;
+        const std::string_view kind = detail::read_token(p, end);
+        if (kind != "a" && kind != "e") return false;
+        VID X, Y;
+        double w;
+        if (!detail::read_vertex(p, end, n, X) || !detail::read_vertex(p, end, n, Y)) return false;
+        if (!detail::read_weight(p, end, w)) return false;
+        out.edges.emplace_back(X, Y);
+        if (weighted) out.weights.push_back(w);
+        if (kind == "e" && X != Y) {
+            out.edges.emplace_back(Y, X);
+            if (weighted) out.weights.push_back(w);
+        }
+        return true;
+    });
+    detail::check_chunks(chunks, path, body - first);
+    return detail::build_graph<T>(n, chunks, key);
+}
+
+}  // namespace telegraph
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <any>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "binary.ipp"
+#include "reader.ipp"
+
+namespace telegraph {
+
+/**
+ * @brief Write a graph in the DOT format.
+ *
+ * Vertices are written with their label, as the "label" attribute, and
+ * their attributes, then each existing edge is written once with its label
+ * and attributes. Attributes of type bool, char, integer, floating point or
+ * std::string are written, attributes of other types and graph attributes
+ * are not. The output is streamed through a large buffer.
+ *
+ * @param G Given graph.
+ * @param out Given output stream.
+ */
+inline void write_dot(const IGraph &G, std::ostream &out);
+
+/**
+ * @brief Write a graph in the DOT format to a file.
+ *
+ * @param G Given graph.
+ * @param path Given file path.
+ * @throws std::runtime_error If the file cannot be written.
+ * @see write_dot
+ */
+inline void write_dot(const IGraph &G, const std::string &path);
+
+/**
+ * @brief Write a graph in the GraphML format.
+ *
+ * Each attribute key is declared once with its GraphML type, labels are
+ * declared as the "label" key of nodes and edges. Attributes are written
+ * as in write_dot. The output is streamed through a large buffer.
+ *
+ * @param G Given graph.
+ * @param out Given output stream.
+ */
+inline void write_graphml(const IGraph &G, std::ostream &out);
+
+/**
+ * @brief Write a graph in the GraphML format to a file.
+ *
+ * @param G Given graph.
+ * @param path Given file path.
+ * @throws std::runtime_error If the file cannot be written.
+ * @see write_graphml
+ */
+inline void write_graphml(const IGraph &G, const std::string &path);
+
+/**
+ * @brief Write a graph in the node-link JSON format.
+ *
+ * The output is an object with the "directed", "graph", "nodes" and
+ * "links" members, as read by NetworkX. Labels and attributes are written
+ * as members of their node or link, non-finite numbers as null. Attributes
+ * are written as in write_dot. The output is streamed through a large
+ * buffer.
+ *
+ * @param G Given graph.
+ * @param out Given output stream.
+ */
+inline void write_json(const IGraph &G, std::ostream &out);
+
+/**
+ * @brief Write a graph in the node-link JSON format to a file.
+ *
+ * @param G Given graph.
+ * @param path Given file path.
+ * @throws std::runtime_error If the file cannot be written.
+ * @see write_json
+ */
+inline void write_json(const IGraph &G, const std::string &path);
+
+/**
+ * @brief Write a graph as an edge list.
+ *
+ * Each existing edge is written on its own line as its source and target,
+ * readable by read_edge_list with the same options. Vertices are written as
+ * their labels if requested, as their ids offset by the base otherwise.
+ * Labels are written as is, hence they must not contain separators, i.e.
+ * blanks or commas, nor start with a comment character. The numeric edge
+ * attribute of the given weight key, if any, is written as a third column.
+ * Isolated vertices are not written. The output is streamed through a
+ * large buffer.
+ *
+ * @param G Given graph.
+ * @param out Given output stream.
+ * @param options Given edge list options.
+ * @throws std::invalid_argument If labels are requested and a vertex has none, or one that cannot be read back.
+ * @throws std::bad_any_cast If the weight key is not bound to a numeric type.
+ */
+inline void write_edge_list(const IGraph &G, std::ostream &out, const EdgeListOptions &options = EdgeListOptions());
+
+/**
+ * @brief Write a graph as an edge list to a file.
+ *
+ * @param G Given graph.
+ * @param path Given file path.
+ * @param options Given edge list options.
+ * @throws std::runtime_error If the file cannot be written.
+ * @see write_edge_list
+ */
+inline void write_edge_list(const IGraph &G, const std::string &path,
+                            const EdgeListOptions &options = EdgeListOptions());
+
+}  // namespace telegraph
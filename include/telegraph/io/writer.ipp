@@ -0,0 +1,535 @@
+#pragma once
+
+#include "writer.hpp"
+
+namespace telegraph {
+
+namespace detail {
+
+//! Number of buffered bytes flushed at once.
+static constexpr std::size_t TEXT_BUFFER = 1 << 20;
+
+/**
+ * @brief Writer of text through a large buffer.
+ *
+ * Bytes are appended to the buffer, which is written to the output stream
+ * once it holds TEXT_BUFFER bytes, hence the stream is written in a few
+ * large calls instead of one per token.
+ */
+struct TextWriter {
+    //! Output stream.
+    std::ostream &out;
+    //! Pending bytes.
+    std::string buffer;
+
+    explicit TextWriter(std::ostream &out) : out(out) { buffer.reserve(TEXT_BUFFER + 64); }
+
+    //! Write the pending bytes.
+    inline void flush() {
+        out.write(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+
+    //! Write the pending bytes if the buffer is full.
+    inline void spill() {
+        if (buffer.size() >= TEXT_BUFFER) flush();
+    }
+
+    //! Write a single character.
+    inline void put(char c) {
+        buffer.push_back(c);
+        spill();
+    }
+
+    //! Write a string.
+    inline void put(std::string_view s) {
+        buffer.append(s);
+        spill();
+    }
+
+    //! Write an integer in decimal form.
+    template <typename N>
+    inline void number(N x) {
+        char bytes[24];
+        const auto [p, ec] = std::to_chars(bytes, bytes + sizeof(bytes), x);
+        buffer.append(bytes, p - bytes);
+        spill();
+    }
+
+    //! Write a string, replacing the characters mapped by a function to a non-empty escape.
+    template <typename F>
+    inline void escaped(std::string_view s, const F &f) {
+        std::size_t i = 0;
+        for (std::size_t j = 0; j < s.size(); j++) {
+            const std::string_view e = f(s[j]);
+            if (e.empty()) continue;
+            buffer.append(s.data() + i, j - i);
+            buffer.append(e);
+            i = j + 1;
+        }
+        buffer.append(s.data() + i, s.size() - i);
+        spill();
+    }
+};
+
+//! Escape of a character in a DOT string.
+inline std::string_view dot_escape(char c) {
+    switch (c) {
+        case '"': return "\\\"";
+        case '\\': return "\\\\";
+        case '\n': return "\\n";
+        default: return std::string_view();
+    }
+}
+
+//! Escape of a character in XML text or attribute values.
+inline std::string_view xml_escape(char c) {
+    switch (c) {
+        case '&': return "&amp;";
+        case '<': return "&lt;";
+        case '>': return "&gt;";
+        case '"': return "&quot;";
+        case '\'': return "&apos;";
+        default: return std::string_view();
+    }
+}
+
+//! Escape of a character in a JSON string.
+inline std::string_view json_escape(char c) {
+    // Escapes of the control characters.
+    static constexpr const char *control[32] = {
+        "\\u0000", "\\u0001", "\\u0002", "\\u0003", "\\u0004", "\\u0005", "\\u0006", "\\u0007",
+        "\\b",     "\\t",     "\\n",     "\\u000b", "\\f",     "\\r",     "\\u000e", "\\u000f",
+        "\\u0010", "\\u0011", "\\u0012", "\\u0013", "\\u0014", "\\u0015", "\\u0016", "\\u0017",
+        "\\u0018", "\\u0019", "\\u001a", "\\u001b", "\\u001c", "\\u001d", "\\u001e", "\\u001f"};
+    if (c == '"') return "\\\"";
+    if (c == '\\') return "\\\\";
+    if (static_cast<unsigned char>(c) < 32) return control[static_cast<unsigned char>(c)];
+    return std::string_view();
+}
+
+/**
+ * @brief Attribute value formatted as text.
+ */
+struct TextValue {
+    //! Kinds of values, deciding how they are quoted.
+    enum Kind { BOOL, INTEGER, REAL, STRING };
+
+    //! Kind of the value.
+    Kind kind;
+    //! Formatted value, pointing to the storage for numbers.
+    std::string_view text;
+    //! Whether the value is a finite number or not a number.
+    bool finite;
+    //! Storage of the formatted numbers.
+    char storage[32];
+};
+
+//! Format a value of the binary format types as text.
+template <typename T>
+inline void to_text(const T &x, TextValue &out) {
+    out.finite = true;
+    if constexpr (std::is_same_v<T, std::string>) {
+        out.kind = TextValue::STRING;
+        out.text = x;
+    } else if constexpr (std::is_same_v<T, bool>) {
+        out.kind = TextValue::BOOL;
+        out.text = x ? "true" : "false";
+    } else {
+        std::to_chars_result r;
+        if constexpr (std::is_floating_point_v<T>) {
+            out.kind = TextValue::REAL;
+            out.finite = std::isfinite(x);
+            r = std::to_chars(out.storage, out.storage + sizeof(out.storage), x);
+        } else {
+            // Promote character types, written as numbers.
+            out.kind = TextValue::INTEGER;
+            r = std::to_chars(out.storage, out.storage + sizeof(out.storage), +x);
+        }
+        out.text = std::string_view(out.storage, r.ptr - out.storage);
+    }
+}
+
+//! GraphML type name of the binary format types.
+template <typename T>
+constexpr const char *graphml_type() {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return "string";
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return "boolean";
+    } else if constexpr (std::is_same_v<T, float>) {
+        return "float";
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return "double";
+    } else if constexpr (sizeof(T) < sizeof(int) || std::is_same_v<T, int>) {
+        return "int";
+    } else {
+        return "long";
+    }
+}
+
+/**
+ * @brief Text view of a vertex or edge attribute column.
+ *
+ * @tparam K Key typename, either VID or EID.
+ */
+template <typename K>
+struct TextColumn {
+    //! Attribute key.
+    std::string key;
+    //! GraphML type name.
+    const char *type = nullptr;
+    //! Format the value of a key, false if none.
+    std::function<bool(const K &, TextValue &)> get;
+};
+
+/**
+ * @brief Text views of the vertex or edge attribute columns of a graph.
+ *
+ * Columns of types outside the binary format are skipped.
+ *
+ * @tparam K Key typename, either VID or EID.
+ * @param G Given graph, nullptr if it has no attributes.
+ * @return std::vector<TextColumn<K>> Text columns, in sorted key order.
+ */
+template <typename K>
+inline std::vector<TextColumn<K>> text_columns(const AbstractGraph *G) {
+    static constexpr bool vertex = std::is_same_v<K, VID>;
+    std::vector<TextColumn<K>> out;
+    if (G == nullptr) return out;
+    for (const std::string &key : vertex ? G->vertex_property_keys() : G->edge_property_keys()) {
+        const std::type_info &type = vertex ? G->vertex_property_type(key) : G->edge_property_type(key);
+        binary_visit(
+            binary_tag(type, BinaryTags()),
+            [&](auto none) {
+                using T = decltype(none);
+                if constexpr (vertex) {
+                    const ConstVertexProperty<T> P = G->vertex_property<T>(key);
+                    out.push_back({key, graphml_type<T>(), [P](const K &X, TextValue &v) {
+                                       if (!P.has(X)) return false;
+                                       to_text(P[X], v);
+                                       return true;
+                                   }});
+                } else {
+                    const ConstEdgeProperty<T> P = G->edge_property<T>(key);
+                    out.push_back({key, graphml_type<T>(), [P](const K &X, TextValue &v) {
+                                       if (!P.has(X)) return false;
+                                       to_text(P[X], v);
+                                       return true;
+                                   }});
+                }
+            },
+            BinaryTags());
+    }
+    return out;
+}
+
+//! Write an attribute value in DOT form, numbers unquoted.
+inline void write_dot_value(const TextValue &v, TextWriter &out) {
+    if (v.kind == TextValue::INTEGER || v.kind == TextValue::BOOL) {
+        out.put(v.text);
+        return;
+    }
+    out.put('"');
+    out.escaped(v.text, dot_escape);
+    out.put('"');
+}
+
+//! Write the attribute list of a DOT vertex or edge statement, if any.
+template <typename K>
+inline void write_dot_attrs(const AbstractGraph *A, const std::vector<TextColumn<K>> &columns, const K &X,
+                            TextWriter &out) {
+    TextValue v;
+    bool first = true;
+    auto open = [&]() {
+        out.put(first ? " [" : ", ");
+        first = false;
+    };
+    if (A != nullptr && A->has_label(X)) {
+        open();
+        out.put("label=\"");
+        out.escaped(A->get_label(X), dot_escape);
+        out.put('"');
+    }
+    for (const TextColumn<K> &c : columns) {
+        if (!c.get(X, v)) continue;
+        open();
+        out.put('"');
+        out.escaped(c.key, dot_escape);
+        out.put("\"=");
+        write_dot_value(v, out);
+    }
+    if (!first) out.put(']');
+}
+
+//! Write the data elements of a GraphML node or edge.
+template <typename K>
+inline void write_graphml_data(const AbstractGraph *A, const std::vector<TextColumn<K>> &columns, char prefix,
+                               const K &X, TextWriter &out) {
+    TextValue v;
+    if (A != nullptr && A->has_label(X)) {
+        out.put("\n      <data key=\"");
+        out.put(prefix);
+        out.put("l\">");
+        out.escaped(A->get_label(X), xml_escape);
+        out.put("</data>");
+    }
+    for (std::size_t i = 0; i < columns.size(); i++) {
+        if (!columns[i].get(X, v)) continue;
+        out.put("\n      <data key=\"");
+        out.put(prefix);
+        out.number(i);
+        out.put("\">");
+        out.escaped(v.text, xml_escape);
+        out.put("</data>");
+    }
+}
+
+//! Write a GraphML key declaration.
+inline void write_graphml_key(std::string_view id, const char *domain, std::string_view name, const char *type,
+                              TextWriter &out) {
+    out.put("  <key id=\"");
+    out.put(id);
+    out.put("\" for=\"");
+    out.put(domain);
+    out.put("\" attr.name=\"");
+    out.escaped(name, xml_escape);
+    out.put("\" attr.type=\"");
+    out.put(type);
+    out.put("\"/>\n");
+}
+
+//! Write a JSON string.
+inline void write_json_string(std::string_view s, TextWriter &out) {
+    out.put('"');
+    out.escaped(s, json_escape);
+    out.put('"');
+}
+
+//! Write the label and attribute members of a JSON node or link.
+template <typename K>
+inline void write_json_members(const AbstractGraph *A, const std::vector<TextColumn<K>> &columns, const K &X,
+                               TextWriter &out) {
+    TextValue v;
+    if (A != nullptr && A->has_label(X)) {
+        out.put(", \"label\": ");
+        write_json_string(A->get_label(X), out);
+    }
+    for (const TextColumn<K> &c : columns) {
+        if (!c.get(X, v)) continue;
+        out.put(", ");
+        write_json_string(c.key, out);
+        out.put(": ");
+        if (v.kind == TextValue::STRING) {
+            write_json_string(v.text, out);
+        } else {
+            out.put(v.finite ? v.text : "null");
+        }
+    }
+}
+
+//! Open a file for writing a text format, with the file path in the error.
+inline std::ofstream open_text(const std::string &path) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) throw IO_ERROR(path);
+    return out;
+}
+
+//! Close a file written in a text format, with the file path in the error.
+inline void close_text(std::ofstream &out, const std::string &path) {
+    out.close();
+    if (!out) throw IO_ERROR(path);
+}
+
+}  // namespace detail
+
+inline void write_dot(const IGraph &G, std::ostream &out) {
+    const auto *A = dynamic_cast<const AbstractGraph *>(&G);
+    const auto vcols = detail::text_columns<VID>(A);
+    const auto ecols = detail::text_columns<EID>(A);
+    detail::TextWriter writer(out);
+    writer.put("digraph {\n");
+    if (A != nullptr && A->has_label()) {
+        writer.put("  label=\"");
+        writer.escaped(A->get_label(), detail::dot_escape);
+        writer.put("\";\n");
+    }
+    // Write every vertex, so that isolated ones are kept.
+    for (const VID &X : G.V()) {
+        writer.put("  ");
+        writer.number(X);
+        detail::write_dot_attrs(A, vcols, X, writer);
+        writer.put(";\n");
+    }
+    for (const VID &X : G.V()) {
+        for (const VID &Y : G.Ch(X)) {
+            writer.put("  ");
+            writer.number(X);
+            writer.put(" -> ");
+            writer.number(Y);
+            detail::write_dot_attrs(A, ecols, EID(X, Y), writer);
+            writer.put(";\n");
+        }
+    }
+    writer.put("}\n");
+    writer.flush();
+}
+
+inline void write_dot(const IGraph &G, const std::string &path) {
+    std::ofstream out = detail::open_text(path);
+    write_dot(G, out);
+    detail::close_text(out, path);
+}
+
+inline void write_graphml(const IGraph &G, std::ostream &out) {
+    const auto *A = dynamic_cast<const AbstractGraph *>(&G);
+    const auto vcols = detail::text_columns<VID>(A);
+    const auto ecols = detail::text_columns<EID>(A);
+    detail::TextWriter writer(out);
+    writer.put("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+    writer.put("<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n");
+    // Declare the labels and the attribute keys.
+    if (A != nullptr) {
+        detail::write_graphml_key("gl", "graph", "label", "string", writer);
+        detail::write_graphml_key("vl", "node", "label", "string", writer);
+        detail::write_graphml_key("el", "edge", "label", "string", writer);
+    }
+    for (std::size_t i = 0; i < vcols.size(); i++) {
+        detail::write_graphml_key("v" + std::to_string(i), "node", vcols[i].key, vcols[i].type, writer);
+    }
+    for (std::size_t i = 0; i < ecols.size(); i++) {
+        detail::write_graphml_key("e" + std::to_string(i), "edge", ecols[i].key, ecols[i].type, writer);
+    }
+    writer.put("  <graph edgedefault=\"directed\">\n");
+    if (A != nullptr && A->has_label()) {
+        writer.put("    <data key=\"gl\">");
+        writer.escaped(A->get_label(), detail::xml_escape);
+        writer.put("</data>\n");
+    }
+    for (const VID &X : G.V()) {
+        writer.put("    <node id=\"n");
+        writer.number(X);
+        writer.put("\">");
+        detail::write_graphml_data(A, vcols, 'v', X, writer);
+        writer.put("</node>\n");
+    }
+    for (const VID &X : G.V()) {
+        for (const VID &Y : G.Ch(X)) {
+            writer.put("    <edge source=\"n");
+            writer.number(X);
+            writer.put("\" target=\"n");
+            writer.number(Y);
+            writer.put("\">");
+            detail::write_graphml_data(A, ecols, 'e', EID(X, Y), writer);
+            writer.put("</edge>\n");
+        }
+    }
+    writer.put("  </graph>\n</graphml>\n");
+    writer.flush();
+}
+
+inline void write_graphml(const IGraph &G, const std::string &path) {
+    std::ofstream out = detail::open_text(path);
+    write_graphml(G, out);
+    detail::close_text(out, path);
+}
+
+inline void write_json(const IGraph &G, std::ostream &out) {
+    const auto *A = dynamic_cast<const AbstractGraph *>(&G);
+    const auto vcols = detail::text_columns<VID>(A);
+    const auto ecols = detail::text_columns<EID>(A);
+    detail::TextWriter writer(out);
+    writer.put("{\"directed\": true, \"multigraph\": false, \"graph\": {");
+    if (A != nullptr && A->has_label()) {
+        writer.put("\"label\": ");
+        detail::write_json_string(A->get_label(), writer);
+    }
+    writer.put("},\n\"nodes\": [");
+    bool first = true;
+    for (const VID &X : G.V()) {
+        writer.put(first ? "\n  {\"id\": " : ",\n  {\"id\": ");
+        writer.number(X);
+        detail::write_json_members(A, vcols, X, writer);
+        writer.put('}');
+        first = false;
+    }
+    writer.put("\n],\n\"links\": [");
+    first = true;
+    for (const VID &X : G.V()) {
+        for (const VID &Y : G.Ch(X)) {
+            writer.put(first ? "\n  {\"source\": " : ",\n  {\"source\": ");
+            writer.number(X);
+            writer.put(", \"target\": ");
+            writer.number(Y);
+            detail::write_json_members(A, ecols, EID(X, Y), writer);
+            writer.put('}');
+            first = false;
+        }
+    }
+    writer.put("\n]}\n");
+    writer.flush();
+}
+
+inline void write_json(const IGraph &G, const std::string &path) {
+    std::ofstream out = detail::open_text(path);
+    write_json(G, out);
+    detail::close_text(out, path);
+}
+
+inline void write_edge_list(const IGraph &G, std::ostream &out, const EdgeListOptions &options) {
+    const auto *A = dynamic_cast<const AbstractGraph *>(&G);
+    // Resolve the vertex labels once.
+    std::vector<std::string> labels;
+    if (options.labels) {
+        for (const VID &X : G.V()) {
+            if (A == nullptr) throw NO_LABEL(X);
+            if (X >= labels.size()) labels.resize(X + 1);
+            labels[X] = A->get_label(X);
+            // Labels are read back as tokens, without unquoting.
+            if (labels[X][0] == '#' || labels[X][0] == '%' ||
+                std::any_of(labels[X].begin(), labels[X].end(), [](char c) { return c == '\n' || detail::is_blank(c); })) {
+                throw UNQUOTED_LABEL(labels[X]);
+            }
+        }
+    }
+    // Find the weight column, if any.
+    detail::TextColumn<EID> weight;
+    if (A != nullptr && !options.weight.empty()) {
+        for (auto &c : detail::text_columns<EID>(A)) {
+            if (c.key != options.weight) continue;
+            if (std::string_view(c.type) == "string" || std::string_view(c.type) == "boolean") {
+                throw std::bad_any_cast();
+            }
+            weight = std::move(c);
+        }
+    }
+    detail::TextWriter writer(out);
+    detail::TextValue v;
+    for (const VID &X : G.V()) {
+        for (const VID &Y : G.Ch(X)) {
+            if (options.labels) {
+                writer.put(labels[X]);
+                writer.put(' ');
+                writer.put(labels[Y]);
+            } else {
+                writer.number(X + options.base);
+                writer.put(' ');
+                writer.number(Y + options.base);
+            }
+            if (weight.get && weight.get(EID(X, Y), v)) {
+                writer.put(' ');
+                writer.put(v.text);
+            }
+            writer.put('\n');
+        }
+    }
+    writer.flush();
+}
+
+inline void write_edge_list(const IGraph &G, const std::string &path, const EdgeListOptions &options) {
+    std::ofstream out = detail::open_text(path);
+    write_edge_list(G, out, options);
+    detail::close_text(out, path);
+}
+
+}  // namespace telegraph
@@ -0,0 +1,516 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <numeric>
+#include <queue>
+#include <telegraph/telegraph>
+
+using namespace telegraph;
+
+// Define fixture class template
+template <typename T>
+class AlgorithmTest : public ::testing::Test {};
+
+// Define list of types
+using GraphTypes = ::testing::Types<DenseGraph, SparseGraph, DynamicGraph>;
+
+// Create typed test suite
+TYPED_TEST_SUITE(AlgorithmTest, GraphTypes);
+
+// Random directed graph with a given number of vertices and edges per vertex.
+template <typename T>
+T random_graph(std::size_t n, std::size_t k, unsigned seed) {
+    std::srand(seed);
+    std::vector<EID> E;
+    for (VID i = 0; i < n; i++) {
+        for (std::size_t j = 0; j < k; j++) E.emplace_back(i, std::rand() % n);
+    }
+    T G(n);
+    G.add_edges(E.begin(), E.end());
+    return G;
+}
+
+// Reference breadth-first search distances through the adjacency list.
+std::vector<std::size_t> reference_bfs(const IGraph &G, const VID &X, std::size_t n) {
+    AdjacencyList L(G);
+    std::vector<std::size_t> d(n, BFSTree::INF);
+    std::queue<VID> Q;
+    d[X] = 0;
+    Q.push(X);
+    while (!Q.empty()) {
+        VID Y = Q.front();
+        Q.pop();
+        for (const VID &Z : L[Y]) {
+            if (d[Z] != BFSTree::INF) continue;
+            d[Z] = d[Y] + 1;
+            Q.push(Z);
+        }
+    }
+    return d;
+}
+
+// Check a tree against the reference distances.
+void check_bfs(const IGraph &G, const BFSTree &T, const std::vector<std::size_t> &d) {
+    ASSERT_EQ(T.distance, d);
+    for (VID Y = 0; Y < d.size(); Y++) {
+        if (d[Y] == BFSTree::INF) {
+            ASSERT_EQ(T.parent[Y], BFSTree::NONE);
+        } else if (d[Y] > 0) {
+            ASSERT_TRUE(G.has_edge(EID(T.parent[Y], Y)));
+            ASSERT_EQ(d[T.parent[Y]] + 1, d[Y]);
+        }
+    }
+}
+
+TYPED_TEST(AlgorithmTest, BFS) {
+    // Path with an unreachable tail.
+    TypeParam G(5);
+    G.add_edge(EID(0, 1));
+    G.add_edge(EID(1, 2));
+    G.add_edge(EID(3, 2));
+    BFSTree T = bfs(G, 0);
+    ASSERT_EQ(T.distance, std::vector<std::size_t>({0, 1, 2, BFSTree::INF, BFSTree::INF}));
+    ASSERT_EQ(T.parent, std::vector<VID>({0, 0, 1, BFSTree::NONE, BFSTree::NONE}));
+    ASSERT_THROW(bfs(G, 5), NOT_DEFINED);
+
+    // Dispatch through the interface.
+    const IGraph &I = G;
+    ASSERT_EQ(bfs(I, 3).distance, std::vector<std::size_t>({BFSTree::INF, BFSTree::INF, 1, 0, BFSTree::INF}));
+}
+
+TYPED_TEST(AlgorithmTest, BFSRandom) {
+    // Sparse and dense random graphs, exercising both directions.
+    for (std::size_t k : {1, 2, 16}) {
+        TypeParam G = random_graph<TypeParam>(300, k, k);
+        check_bfs(G, bfs(G, 0), reference_bfs(G, 0, 300));
+    }
+
+    // Multiple worker threads.
+    set_concurrency(4);
+    TypeParam G = random_graph<TypeParam>(5000, 8, 42);
+    check_bfs(G, bfs(G, 7), reference_bfs(G, 7, 5000));
+    set_concurrency(0);
+
+    // Deleted vertices are never reached.
+    G.set_tombstone_mode(true);
+    G.del_vertex(VID(1));
+    BFSTree T = bfs(G, 7);
+    ASSERT_EQ(T.distance[1], BFSTree::INF);
+    check_bfs(G, T, reference_bfs(G, 7, T.distance.size()));
+}
+
+TYPED_TEST(AlgorithmTest, DFS) {
+    TypeParam G(6);
+    G.add_edge(EID(0, 1));
+    G.add_edge(EID(1, 2));
+    G.add_edge(EID(0, 3));
+    G.add_edge(EID(4, 3));
+    DFSTree T = dfs(G, 0);
+    ASSERT_EQ(T.discovery, std::vector<std::size_t>({0, 1, 2, 5, DFSTree::INF, DFSTree::INF}));
+    ASSERT_EQ(T.finish, std::vector<std::size_t>({7, 4, 3, 6, DFSTree::INF, DFSTree::INF}));
+    ASSERT_EQ(T.parent, std::vector<VID>({0, 0, 1, 0, DFSTree::NONE, DFSTree::NONE}));
+    ASSERT_THROW(dfs(G, 6), NOT_DEFINED);
+
+    // Whole graph forest.
+    T = dfs(G);
+    ASSERT_EQ(T.parent, std::vector<VID>({0, 0, 1, 0, 4, 5}));
+    ASSERT_EQ(T.discovery[4], 8);
+    ASSERT_EQ(T.finish[5], 11);
+}
+
+TYPED_TEST(AlgorithmTest, TopologicalSort) {
+    TypeParam G = random_graph<TypeParam>(200, 3, 7);
+    // Keep forward edges only.
+    std::vector<EID> E;
+    for (const EID &X : G.E()) {
+        if (X.first >= X.second) E.push_back(X);
+    }
+    ASSERT_FALSE(is_acyclic(G));
+    ASSERT_THROW(topological_sort(G), std::invalid_argument);
+    G.del_edges(E.begin(), E.end());
+    ASSERT_TRUE(is_acyclic(G));
+    std::vector<VID> S = topological_sort(G);
+    ASSERT_EQ(S.size(), 200);
+    std::vector<std::size_t> p(200);
+    for (std::size_t i = 0; i < S.size(); i++) p[S[i]] = i;
+    for (const EID &X : G.E()) ASSERT_LT(p[X.first], p[X.second]);
+
+    // Self loops are cycles.
+    G.add_edge(EID(5, 5));
+    ASSERT_FALSE(is_acyclic(G));
+}
+
+TYPED_TEST(AlgorithmTest, StronglyConnectedComponents) {
+    TypeParam G(7);
+    for (const EID &X : {EID(0, 1), EID(1, 2), EID(2, 0), EID(2, 3), EID(3, 4), EID(4, 3), EID(5, 4)}) {
+        G.add_edge(X);
+    }
+    Components C = strongly_connected_components(G);
+    ASSERT_EQ(C.count, 4);
+    ASSERT_EQ(C.component[0], C.component[1]);
+    ASSERT_EQ(C.component[0], C.component[2]);
+    ASSERT_EQ(C.component[3], C.component[4]);
+    ASSERT_NE(C.component[0], C.component[3]);
+    // Reverse topological order of the condensation.
+    ASSERT_GT(C.component[0], C.component[3]);
+    ASSERT_GT(C.component[5], C.component[4]);
+
+    // Mutual reachability on a random graph.
+    TypeParam H = random_graph<TypeParam>(80, 1, 3);
+    C = strongly_connected_components(H);
+    std::vector<std::vector<std::size_t>> D;
+    for (VID X = 0; X < 80; X++) D.push_back(bfs(H, X).distance);
+    for (VID X = 0; X < 80; X++) {
+        for (VID Y = 0; Y < 80; Y++) {
+            bool strong = D[X][Y] != BFSTree::INF && D[Y][X] != BFSTree::INF;
+            ASSERT_EQ(C.component[X] == C.component[Y], strong);
+        }
+    }
+}
+
+TEST(AlgorithmTest, ParallelFor) {
+    set_concurrency(4);
+    // Each index is visited once, by a worker in range, across repeated calls.
+    for (std::size_t r = 0; r < 100; r++) {
+        std::vector<std::atomic<int>> visits(1000);
+        parallel_for(visits.size(), 7, [&](std::size_t b, std::size_t e, std::size_t t) {
+            ASSERT_LT(t, 4);
+            for (std::size_t i = b; i < e; i++) visits[i]++;
+        });
+        for (const auto &v : visits) ASSERT_EQ(v, 1);
+    }
+    // Nested calls run on the calling worker.
+    std::atomic<std::size_t> sum(0);
+    parallel_for(8, 1, [&](std::size_t, std::size_t, std::size_t) {
+        parallel_for(100, 1, [&](std::size_t b, std::size_t e, std::size_t) { sum += e - b; });
+    });
+    ASSERT_EQ(sum, 800);
+    set_concurrency(0);
+}
+
+TEST(DynamicGraphTest, DeepDFS) {
+    // A path deep enough to overflow a recursive search.
+    const std::size_t n = 1000000;
+    std::vector<EID> E;
+    for (VID i = 0; i + 1 < n; i++) E.emplace_back(i, i + 1);
+    DynamicGraph G(n);
+    G.add_edges(E.begin(), E.end());
+    ASSERT_TRUE(is_acyclic(G));
+    ASSERT_EQ(topological_sort(G).front(), 0);
+    ASSERT_EQ(dfs(G, 0).finish[0], 2 * n - 1);
+    ASSERT_EQ(strongly_connected_components(G).count, n);
+}
+
+TYPED_TEST(AlgorithmTest, CSR) {
+    TypeParam G(4);
+    G.add_edge(EID(0, 2));
+    G.add_edge(EID(2, 1));
+    G.add_edge(EID(2, 3));
+    G.set_attr(EID(2, 3), "weight", 2.5);
+    CSR C(G, "weight");
+    ASSERT_EQ(C.rows(), 4);
+    ASSERT_EQ(C.nonzeros(), 3);
+    ASSERT_EQ(C.offsets, std::vector<std::size_t>({0, 1, 1, 3, 3}));
+    ASSERT_EQ(C.weights, std::vector<double>({1, 1, 2.5}));
+    CSR T = C.transpose();
+    ASSERT_EQ(T.offsets, std::vector<std::size_t>({0, 0, 1, 2, 3}));
+    ASSERT_EQ(T.targets, std::vector<VID>({2, 0, 2}));
+    ASSERT_EQ(T.weights, std::vector<double>({1, 1, 2.5}));
+
+    // Integer weights are converted, other types are rejected.
+    G.set_attr(EID(0, 2), "cost", 3);
+    ASSERT_EQ(CSR(G, "cost").weights, std::vector<double>({3, 1, 1}));
+    G.set_attr(EID(2, 1), "short", short(4));
+    G.set_attr(EID(2, 1), "char", char(5));
+    G.set_attr(EID(2, 1), "size", std::size_t(6));
+    G.set_attr(EID(2, 1), "long double", 7.5L);
+    ASSERT_EQ(CSR(G, "short").weights, std::vector<double>({1, 4, 1}));
+    ASSERT_EQ(CSR(G, "char").weights, std::vector<double>({1, 5, 1}));
+    ASSERT_EQ(CSR(G, "size").weights, std::vector<double>({1, 6, 1}));
+    ASSERT_EQ(CSR(G, "long double").weights, std::vector<double>({1, 7.5, 1}));
+    G.set_attr(EID(0, 2), "flag", true);
+    ASSERT_THROW(CSR(G, "flag"), std::bad_any_cast);
+    G.set_attr(EID(0, 2), "name", std::string("a"));
+    ASSERT_THROW(CSR(G, "name"), std::bad_any_cast);
+}
+
+TYPED_TEST(AlgorithmTest, ShortestPaths) {
+    TypeParam G(5);
+    G.add_edge(EID(0, 1));
+    G.add_edge(EID(1, 2));
+    G.add_edge(EID(0, 2));
+    G.add_edge(EID(2, 3));
+    G.set_attr(EID(0, 2), "weight", 5.0);
+    G.set_attr(EID(1, 2), "weight", 0.5);
+    const std::vector<double> d = {0, 1, 1.5, 2.5, ShortestPaths::INF};
+    const std::vector<VID> p = {0, 0, 1, 2, ShortestPaths::NONE};
+    ASSERT_EQ(dijkstra(G, 0).distance, d);
+    ASSERT_EQ(dijkstra(G, 0).parent, p);
+    ASSERT_EQ(delta_stepping(G, 0).distance, d);
+    ASSERT_EQ(delta_stepping(G, 0).parent, p);
+    ASSERT_THROW(dijkstra(G, 5), NOT_DEFINED);
+
+    // Unit weights.
+    ASSERT_EQ(dijkstra(G, 0, "none").distance, std::vector<double>({0, 1, 1, 2, ShortestPaths::INF}));
+
+    // Negative weights.
+    G.set_attr(EID(2, 3), "weight", -1.0);
+    ASSERT_THROW(dijkstra(G, 0), std::invalid_argument);
+    ASSERT_THROW(delta_stepping(G, 0), std::invalid_argument);
+}
+
+TYPED_TEST(AlgorithmTest, ShortestPathsRandom) {
+    set_concurrency(4);
+    TypeParam G = random_graph<TypeParam>(1000, 6, 11);
+    {
+        auto W = G.template edge_property<double>("weight");
+        for (const EID &X : G.E()) W[X] = std::rand() % 100;
+    }
+    ShortestPaths S = dijkstra(G, 0);
+    for (double delta : {0.0, 1.0, 10.0, 1000.0}) {
+        ShortestPaths T = delta_stepping(G, 0, delta);
+        ASSERT_EQ(T.distance, S.distance);
+        for (VID Y = 1; Y < 1000; Y++) {
+            if (T.distance[Y] == ShortestPaths::INF) continue;
+            const VID Z = T.parent[Y];
+            ASSERT_TRUE(G.has_edge(EID(Z, Y)));
+            ASSERT_EQ(T.distance[Z] + G.template get_attr<double>(EID(Z, Y), "weight"), T.distance[Y]);
+        }
+    }
+    set_concurrency(0);
+
+    // Unit weights match the breadth-first distances.
+    BFSTree T = bfs(G, 0);
+    S = delta_stepping(G, 0, 0, "none");
+    for (VID Y = 0; Y < 1000; Y++) {
+        ASSERT_EQ(S.distance[Y] == ShortestPaths::INF, T.distance[Y] == BFSTree::INF);
+        if (T.distance[Y] != BFSTree::INF) {
+            ASSERT_EQ(S.distance[Y], T.distance[Y]);
+        }
+    }
+}
+
+TYPED_TEST(AlgorithmTest, Triangles) {
+    // Two triangles sharing an edge, with a reversed edge, a self loop and a tail.
+    TypeParam G(6);
+    for (const EID &X : {EID(0, 1), EID(1, 2), EID(2, 0), EID(3, 1), EID(2, 3), EID(3, 3), EID(3, 4)}) {
+        G.add_edge(X);
+    }
+    ASSERT_EQ(count_triangles(G), 2);
+    ASSERT_EQ(vertex_triangles(G), std::vector<std::size_t>({1, 2, 2, 1, 0, 0}));
+    ASSERT_EQ(local_clustering(G), std::vector<double>({1, 2.0 / 3, 2.0 / 3, 1.0 / 3, 0, 0}));
+    // Six triangle triples over ten connected triples.
+    ASSERT_DOUBLE_EQ(global_clustering(G), 0.6);
+    ASSERT_EQ(global_clustering(TypeParam(3)), 0);
+
+    // Brute force over the undirected adjacency on a random graph.
+    set_concurrency(4);
+    TypeParam H = random_graph<TypeParam>(120, 6, 5);
+    std::vector<std::vector<bool>> U(120, std::vector<bool>(120, false));
+    for (const EID &X : H.E()) {
+        if (X.first == X.second) continue;
+        U[X.first][X.second] = U[X.second][X.first] = true;
+    }
+    std::size_t total = 0;
+    std::vector<std::size_t> t(120, 0);
+    for (VID X = 0; X < 120; X++) {
+        for (VID Y = X + 1; Y < 120; Y++) {
+            for (VID Z = Y + 1; Z < 120; Z++) {
+                if (!U[X][Y] || !U[Y][Z] || !U[X][Z]) continue;
+                total++;
+                t[X]++;
+                t[Y]++;
+                t[Z]++;
+            }
+        }
+    }
+    ASSERT_EQ(count_triangles(H), total);
+    ASSERT_EQ(vertex_triangles(H), t);
+    set_concurrency(0);
+}
+
+TYPED_TEST(AlgorithmTest, WeaklyConnectedComponents) {
+    TypeParam G(7);
+    for (const EID &X : {EID(1, 0), EID(2, 1), EID(3, 4), EID(6, 6)}) G.add_edge(X);
+    Components C = weakly_connected_components(G);
+    ASSERT_EQ(C.count, 4);
+    ASSERT_EQ(C.component, std::vector<std::size_t>({0, 0, 0, 1, 1, 2, 3}));
+
+    // Incremental updates match a full recomputation.
+    set_concurrency(4);
+    TypeParam H = random_graph<TypeParam>(5000, 1, 9);
+    ConnectedComponents I(H);
+    ASSERT_EQ(I.components().component, weakly_connected_components(H).component);
+    std::srand(10);
+    for (std::size_t i = 0; i < 4; i++) {
+        std::vector<EID> E;
+        for (std::size_t j = 0; j < 500; j++) E.emplace_back(std::rand() % 5000, std::rand() % 5000);
+        H.add_edges(E.begin(), E.end());
+        I.add_edges(E.begin(), E.end());
+        C = weakly_connected_components(H);
+        ASSERT_EQ(I.count(), C.count);
+        ASSERT_EQ(I.components().component, C.component);
+    }
+    set_concurrency(0);
+
+    // Mutual reachability on the undirected graph.
+    std::vector<EID> E;
+    for (const EID &X : H.E()) E.emplace_back(X.second, X.first);
+    H.add_edges(E.begin(), E.end());
+    BFSTree T = bfs(H, 0);
+    for (VID X = 0; X < 5000; X++) ASSERT_EQ(I.connected(0, X), T.distance[X] != BFSTree::INF);
+
+    // New vertices are new components.
+    I.add_vertex(6000);
+    ASSERT_EQ(I.count(), C.count + 1);
+    ASSERT_FALSE(I.has_vertex(5500));
+    ASSERT_THROW(I.add_edge(EID(5500, 6000)), NOT_DEFINED);
+    ASSERT_THROW(I.add_vertex(6000), ALREADY_DEFINED);
+    I.add_edge(EID(6000, 4999));
+    ASSERT_EQ(I.find(6000), I.find(4999));
+    ASSERT_EQ(I.components().component[5500], Components::NONE);
+}
+
+// Reference PageRank through the children ranges.
+std::vector<double> reference_pagerank(const IGraph &G, std::size_t n, double d) {
+    std::vector<double> x(n, 1.0 / n), y(n);
+    for (std::size_t i = 0; i < 1000; i++) {
+        double s = 0;
+        for (const VID &X : G.V()) {
+            if (G.out_degree(X) == 0) s += x[X];
+        }
+        std::fill(y.begin(), y.end(), (1 - d + d * s) / n);
+        for (const VID &X : G.V()) {
+            for (const VID &Y : G.Ch(X)) y[Y] += d * x[X] / G.out_degree(X);
+        }
+        x.swap(y);
+    }
+    return x;
+}
+
+TYPED_TEST(AlgorithmTest, Centrality) {
+    // Undirected star, the center scores sqrt(k) times the leaves.
+    TypeParam G(5);
+    for (VID i = 1; i < 5; i++) {
+        G.add_edge(EID(0, i));
+        G.add_edge(EID(i, 0));
+    }
+    Centrality C = eigenvector_centrality(G);
+    ASSERT_NEAR(C.score[0] / C.score[1], 2, 1e-6);
+    ASSERT_NEAR(C.score[1], C.score[4], 1e-9);
+    ASSERT_LT(C.residual, 1e-9);
+    C = pagerank(G);
+    ASSERT_NEAR(std::accumulate(C.score.begin(), C.score.end(), 0.0), 1, 1e-9);
+    ASSERT_GT(C.score[0], C.score[1]);
+
+    // Path, with the base score plus the attenuated score of the parent.
+    TypeParam P(3);
+    P.add_edge(EID(0, 1));
+    P.add_edge(EID(1, 2));
+    C = katz_centrality(P, 0.5, 1);
+    ASSERT_NEAR(C.score[0], 1, 1e-9);
+    ASSERT_NEAR(C.score[1], 1.5, 1e-9);
+    ASSERT_NEAR(C.score[2], 1.75, 1e-9);
+
+    // Random graph with dangling vertices, against the reference.
+    set_concurrency(4);
+    TypeParam H = random_graph<TypeParam>(3000, 3, 13);
+    std::vector<EID> E;
+    for (const VID &X : H.Ch(5)) E.emplace_back(5, X);
+    H.del_edges(E.begin(), E.end());
+    C = pagerank(H, 0.85, 1e-12, 1000);
+    std::vector<double> R = reference_pagerank(H, 3000, 0.85);
+    for (VID X = 0; X < 3000; X++) ASSERT_NEAR(C.score[X], R[X], 1e-9);
+
+    // Warm start after a small change.
+    std::srand(14);
+    for (std::size_t i = 0; i < 10; i++) {
+        EID X(std::rand() % 3000, std::rand() % 3000);
+        if (!H.has_edge(X)) H.add_edge(X);
+    }
+    Centrality cold = pagerank(H, 0.85, 1e-10, 1000);
+    Centrality warm = pagerank(H, 0.85, 1e-10, 1000, C.score);
+    ASSERT_LT(warm.iterations, cold.iterations);
+    for (VID X = 0; X < 3000; X++) ASSERT_NEAR(warm.score[X], cold.score[X], 1e-9);
+    set_concurrency(0);
+}
+
+TYPED_TEST(AlgorithmTest, MinimumSpanningForest) {
+    // A square with a diagonal, reversed edges and a self loop, plus an isolated edge.
+    TypeParam G(6);
+    for (const EID &X : {EID(0, 1), EID(2, 1), EID(2, 3), EID(3, 0), EID(0, 2), EID(1, 1), EID(4, 5)}) {
+        G.add_edge(X);
+    }
+    G.set_attr(EID(0, 1), "weight", 4);
+    G.set_attr(EID(2, 1), "weight", 1);
+    G.set_attr(EID(2, 3), "weight", 3);
+    G.set_attr(EID(3, 0), "weight", 2);
+    G.set_attr(EID(0, 2), "weight", 5);
+    G.set_attr(EID(1, 1), "weight", -1);
+    G.set_attr(EID(4, 5), "weight", -7);
+    SpanningForest F = kruskal(G);
+    ASSERT_EQ(F.edges, std::vector<EID>({EID(4, 5), EID(2, 1), EID(3, 0), EID(2, 3)}));
+    ASSERT_EQ(F.weight, -1);
+    F = boruvka(G);
+    ASSERT_EQ(F.edges, std::vector<EID>({EID(2, 1), EID(2, 3), EID(3, 0), EID(4, 5)}));
+    ASSERT_EQ(F.weight, -1);
+
+    // Caller-supplied weights, in the order of the edges range.
+    std::vector<double> W;
+    for (const EID &X : G.E()) W.push_back(X == EID(0, 2) ? 0 : 10);
+    F = minimum_spanning_forest(G, W);
+    ASSERT_EQ(F.weight, 30);
+    ASSERT_TRUE(std::find(F.edges.begin(), F.edges.end(), EID(0, 2)) != F.edges.end());
+    ASSERT_THROW(kruskal(G, std::vector<double>(2)), std::invalid_argument);
+
+    // Forest as a graph of the same type, with labels.
+    G.set_label(VID(0), VLB("a"));
+    G.set_label(EID(2, 3), ELB("b"));
+    G.set_label(EID(0, 2), ELB("c"));
+    TypeParam H = edge_subgraph(G, kruskal(G).edges);
+    ASSERT_EQ(H.order(), 6);
+    ASSERT_EQ(H.size(), 4);
+    ASSERT_EQ(H.get_label(VID(0)), "a");
+    ASSERT_EQ(H.get_label(EID(2, 3)), "b");
+    ASSERT_FALSE(H.has_edge(EID(0, 2)));
+    ASSERT_EQ(H.template get_attr<int>(EID(3, 0), "weight"), 2);
+
+    // Both algorithms agree on a random graph, and span every weak component.
+    set_concurrency(4);
+    TypeParam R = random_graph<TypeParam>(4000, 3, 17);
+    {
+        auto P = R.template edge_property<double>("weight");
+        for (const EID &X : R.E()) P[X] = (std::rand() % 1000) / 10.0 - 20;
+    }
+    const SpanningForest K = kruskal(R), B = boruvka(R);
+    ASSERT_NEAR(K.weight, B.weight, 1e-6);
+    ASSERT_EQ(K.edges.size(), 4000 - weakly_connected_components(R).count);
+    ASSERT_EQ(B.edges.size(), K.edges.size());
+    set_concurrency(0);
+}
+
+TYPED_TEST(AlgorithmTest, WeisfeilerLehmanHash) {
+    // Relabeling the vertices does not change the hash.
+    set_concurrency(4);
+    const std::size_t n = 3000;
+    TypeParam G = random_graph<TypeParam>(n, 3, 19);
+    std::vector<VID> P(n);
+    std::iota(P.begin(), P.end(), 0);
+    std::srand(23);
+    for (std::size_t i = n - 1; i > 0; i--) std::swap(P[i], P[std::rand() % (i + 1)]);
+    std::vector<EID> E;
+    for (const EID &X : G.E()) E.emplace_back(P[X.first], P[X.second]);
+    TypeParam H(n);
+    H.add_edges(E.begin(), E.end());
+    ASSERT_EQ(weisfeiler_lehman_hash(G), weisfeiler_lehman_hash(H));
+
+    // Reversing an edge does, and so do vertex labels unless ignored.
+    TypeParam I(AdjacencyList({{0, {1}}, {1, {2}}, {2, {}}}));
+    TypeParam J(AdjacencyList({{0, {1}}, {1, {}}, {2, {1}}}));
+    ASSERT_NE(weisfeiler_lehman_hash(I), weisfeiler_lehman_hash(J));
+    const std::size_t h = weisfeiler_lehman_hash(I);
+    I.set_label(VID(0), VLB("a"));
+    ASSERT_NE(weisfeiler_lehman_hash(I), h);
+    ASSERT_EQ(weisfeiler_lehman_hash(I, 3, false), h);
+    set_concurrency(0);
+}
@@ -0,0 +1,388 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <telegraph/telegraph>
+
+using namespace telegraph;
+
+// Define fixture class template
+template <typename T>
+class IOTest : public ::testing::Test {};
+
+// Define list of types
+using GraphTypes = ::testing::Types<DenseGraph, SparseGraph, DynamicGraph>;
+
+// Create typed test suite
+TYPED_TEST_SUITE(IOTest, GraphTypes);
+
+// Temporary file path for a given test.
+std::string temporary(const std::string &name) { return ::testing::TempDir() + "telegraph_" + name; }
+
+TYPED_TEST(IOTest, Binary) {
+    AdjacencyList A = {
+        {0, {1, 3}},
+        {1, {1, 2}},
+        {2, {4}},
+        {3, {0}},
+        {4, {1, 2, 3}},
+        {5, {}}
+    };
+    TypeParam G(A);
+    G.set_label(GLB("g"));
+    G.set_label(VID(3), VLB("d"));
+    G.set_label(VID(4), VLB("e"));
+    G.set_label(EID(4, 3), ELB("f"));
+    G.set_attr(VID(0), "w", 7);
+    G.set_attr(VID(5), "w", -1);
+    G.set_attr(VID(2), "name", std::string("two"));
+    G.set_attr(EID(4, 2), "weight", 4.2);
+    G.set_attr(EID(1, 1), "loop", true);
+    G.set_attr(VID(1), "opaque", std::vector<int>{1});
+
+    const std::string path = temporary("binary.bin");
+    for (const BinaryLayout &L : {BinaryLayout::AUTO, BinaryLayout::CSR, BinaryLayout::BIT_MATRIX}) {
+        write_binary(G, path, L);
+        const MappedGraph H(path);
+        ASSERT_EQ(H.order(), 6);
+        ASSERT_EQ(H.size(), G.size());
+        ASSERT_EQ(AdjacencyList(H), AdjacencyList(G));
+        ASSERT_EQ(AdjacencyMatrix(H), AdjacencyMatrix(G));
+        ASSERT_TRUE(SparseAdjacencyMatrix(H).isApprox(SparseAdjacencyMatrix(G)));
+        for (const VID &X : G.V()) {
+            ASSERT_EQ(H.in_degree(X), G.in_degree(X));
+            ASSERT_EQ(H.out_degree(X), G.out_degree(X));
+            std::vector<VID> P, Q;
+            for (const VID &Y : G.Pa(X)) P.push_back(Y);
+            for (const VID &Y : H.Pa(X)) Q.push_back(Y);
+            std::sort(P.begin(), P.end());
+            ASSERT_EQ(P, Q);
+        }
+        ASSERT_TRUE(H.has_edge(EID(4, 3)));
+        ASSERT_FALSE(H.has_edge(EID(3, 4)));
+        ASSERT_THROW(H.has_edge(EID(3, 6)), NOT_DEFINED);
+        ASSERT_EQ(std::hash<IGraph>()(H), std::hash<IGraph>()(G));
+        const MemoryUsage U = H.memory_usage();
+        ASSERT_EQ(U.adjacency, 0);
+        ASSERT_GT(U.vertex_attributes, 0);
+        ASSERT_LT(U.total(), U.mapped);
+
+        // Labels and attributes are read in place.
+        ASSERT_EQ(H.get_label(), "g");
+        ASSERT_EQ(H.get_label(VID(3)), "d");
+        ASSERT_FALSE(H.has_label(VID(0)));
+        ASSERT_THROW(H.get_label(VID(0)), NO_LABEL);
+        ASSERT_EQ(H.get_label(EID(4, 3)), "f");
+        ASSERT_FALSE(H.has_label(EID(4, 2)));
+        ASSERT_EQ(H.template get_attr<int>(VID(0), "w"), 7);
+        ASSERT_EQ(H.template get_attr<int>(VID(5), "w"), -1);
+        ASSERT_FALSE(H.has_attr(VID(1), "w"));
+        ASSERT_EQ(H.template get_attr<std::string>(VID(2), "name"), "two");
+        ASSERT_EQ(H.template get_attr<double>(EID(4, 2), "weight"), 4.2);
+        ASSERT_TRUE(H.template get_attr<bool>(EID(1, 1), "loop"));
+        ASSERT_THROW(H.template get_attr<long>(VID(0), "w"), std::bad_any_cast);
+        ASSERT_THROW(H.template get_attr<int>(VID(1), "w"), std::invalid_argument);
+        ASSERT_EQ(H.vertex_property_keys(), std::vector<std::string>({"name", "w"}));
+        ASSERT_EQ(H.edge_property_keys(), std::vector<std::string>({"loop", "weight"}));
+
+        // The graph is read-only, copies share the mapping.
+        ASSERT_THROW(MappedGraph(H).add_edge(EID(0, 0)), std::logic_error);
+        ASSERT_THROW(MappedGraph(H).add_vertex(), std::logic_error);
+    }
+    ASSERT_EQ(MappedGraph(path).get_layout(), BinaryLayout::BIT_MATRIX);
+    std::remove(path.c_str());
+}
+
+TYPED_TEST(IOTest, BinaryRandom) {
+    // Sparse graph with missing vertex ids.
+    std::srand(5);
+    std::vector<EID> E;
+    for (VID i = 0; i < 2000; i++) {
+        for (std::size_t j = 0; j < 4; j++) E.emplace_back(i, std::rand() % 2000);
+    }
+    std::sort(E.begin(), E.end());
+    E.erase(std::unique(E.begin(), E.end()), E.end());
+    TypeParam G(2000);
+    G.add_edges(E.begin(), E.end());
+    G.set_tombstone_mode(true);
+    G.del_vertex(VID(7));
+    G.del_vertex(VID(1000));
+
+    const std::string path = temporary("random.bin");
+    write_binary(G, path);
+    const MappedGraph H(path);
+    ASSERT_EQ(H.get_layout(), BinaryLayout::CSR);
+    ASSERT_EQ(H.order(), 1998);
+    ASSERT_FALSE(H.has_vertex(VID(7)));
+    ASSERT_EQ(AdjacencyList(H), AdjacencyList(G));
+    ASSERT_EQ(weakly_connected_components(H).count, weakly_connected_components(G).count);
+    ASSERT_EQ(bfs(H, 0).distance, bfs(G, 0).distance);
+    std::remove(path.c_str());
+}
+
+TEST(IOTest, BinaryInvalid) {
+    ASSERT_THROW(MappedGraph(temporary("missing.bin")), std::runtime_error);
+    const std::string path = temporary("invalid.bin");
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "not a graph, not a graph, not a graph, not a graph, not a graph";
+    }
+    ASSERT_THROW(MappedGraph{path}, std::runtime_error);
+    // Truncated file.
+    write_binary(DenseGraph(10), path);
+    std::ifstream in(path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), bytes.size() - 8);
+    }
+    ASSERT_THROW(MappedGraph{path}, std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(IOTest, BinaryCorrupt) {
+    // Section sizes are valid, while their contents are not.
+    DenseGraph G(4);
+    G.add_edge(EID(0, 1));
+    G.add_edge(EID(0, 2));
+    G.add_edge(EID(2, 3));
+    G.set_label(VID(1), VLB("ab"));
+    const std::string path = temporary("corrupt.bin");
+    write_binary(G, path, BinaryLayout::CSR);
+    std::ifstream in(path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    // Overwrite a single word, given its position after the header.
+    auto patch = [&](std::size_t i, std::uint64_t value) {
+        std::string copy = bytes;
+        std::memcpy(&copy[sizeof(detail::BinaryHeader) + 8 * i], &value, 8);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(copy.data(), copy.size());
+    };
+    patch(0, 15);  // Present vertices, unchanged.
+    ASSERT_EQ(AdjacencyList(MappedGraph(path)), AdjacencyList(G));
+    patch(2, 4);  // Child offset past the number of edges.
+    ASSERT_THROW(MappedGraph{path}, std::runtime_error);
+    patch(3, 1);  // Decreasing child offsets.
+    ASSERT_THROW(MappedGraph{path}, std::runtime_error);
+    patch(6, 100);  // Child out of range.
+    ASSERT_THROW(MappedGraph{path}, std::runtime_error);
+    patch(7, 1);  // Unsorted children.
+    ASSERT_THROW(MappedGraph{path}, std::runtime_error);
+    patch(14, 4);  // Parent out of range.
+    ASSERT_THROW(MappedGraph{path}, std::runtime_error);
+    patch(20, 4);  // Vertex label key out of range.
+    ASSERT_THROW(MappedGraph{path}, std::runtime_error);
+    patch(21, 3);  // Decreasing string offsets.
+    ASSERT_THROW(MappedGraph{path}, std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TYPED_TEST(IOTest, EdgeList) {
+    const std::string path = temporary("edges.txt");
+    {
+        std::ofstream out(path);
+        out << "# comment\n0 1\n1,2\n\n% comment\n2\t0\n4 4\n0 1\n";
+    }
+    TypeParam G = read_edge_list<TypeParam>(path);
+    ASSERT_EQ(G.order(), 5);
+    ASSERT_EQ(G.size(), 4);
+    ASSERT_TRUE(G.has_edge(EID(1, 2)));
+    ASSERT_TRUE(G.has_edge(EID(4, 4)));
+    ASSERT_FALSE(G.has_edge(EID(1, 0)));
+    // Labels and weights.
+    {
+        std::ofstream out(path);
+        out << "a b 1.5\nb c\nc a -2\n";
+    }
+    EdgeListOptions options;
+    options.labels = true;
+    options.weight = "weight";
+    G = read_edge_list<TypeParam>(path, options);
+    ASSERT_EQ(G.order(), 3);
+    ASSERT_EQ(G.size(), 3);
+    ASSERT_EQ(G.get_label(VID(0)), "a");
+    ASSERT_EQ(G.get_label(VID(2)), "c");
+    ASSERT_EQ(G.template get_attr<double>(EID(0, 1), "weight"), 1.5);
+    ASSERT_EQ(G.template get_attr<double>(EID(2, 0), "weight"), -2);
+    ASSERT_FALSE(G.has_attr(EID(1, 2), "weight"));
+    // 1-based ids.
+    {
+        std::ofstream out(path);
+        out << "1 2\n0 1\n";
+    }
+    options = EdgeListOptions();
+    options.base = 1;
+    ASSERT_THROW(read_edge_list<TypeParam>(path, options), std::runtime_error);
+    ASSERT_THROW(read_edge_list<TypeParam>(temporary("missing.txt")), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TYPED_TEST(IOTest, EdgeListRandom) {
+    // Large enough to be split into several chunks.
+    std::srand(7);
+    std::vector<EID> E;
+    std::string bytes;
+    for (std::size_t i = 0; i < 300000; i++) {
+        E.emplace_back(std::rand() % 50000, std::rand() % 50000);
+        bytes += std::to_string(E.back().first) + " " + std::to_string(E.back().second) + "\n";
+    }
+    const std::string path = temporary("random.txt");
+    {
+        std::ofstream out(path);
+        out << bytes;
+    }
+    std::size_t n = 0;
+    for (const EID &e : E) n = std::max<std::size_t>(n, std::max(e.first, e.second) + 1);
+    std::sort(E.begin(), E.end());
+    E.erase(std::unique(E.begin(), E.end()), E.end());
+    const TypeParam G = read_edge_list<TypeParam>(path);
+    ASSERT_EQ(G.order(), n);
+    ASSERT_EQ(G.size(), E.size());
+    for (const EID &e : E) ASSERT_TRUE(G.has_edge(e));
+    std::remove(path.c_str());
+}
+
+TYPED_TEST(IOTest, MatrixMarket) {
+    const std::string path = temporary("matrix.mtx");
+    {
+        std::ofstream out(path);
+        out << "%%MatrixMarket matrix coordinate real symmetric\n% comment\n4 4 3\n1 1 0.5\n2 1 2\n4 3 -1e1\n";
+    }
+    TypeParam G = read_matrix_market<TypeParam>(path);
+    ASSERT_EQ(G.order(), 4);
+    ASSERT_EQ(G.size(), 5);
+    ASSERT_TRUE(G.has_edge(EID(0, 1)));
+    ASSERT_TRUE(G.has_edge(EID(1, 0)));
+    ASSERT_EQ(G.template get_attr<double>(EID(3, 2), "weight"), -10);
+    ASSERT_EQ(G.template get_attr<double>(EID(2, 3), "weight"), -10);
+    {
+        std::ofstream out(path);
+        out << "%%MatrixMarket matrix coordinate pattern general\n3 2 2\n3 1\n1 2\n";
+    }
+    G = read_matrix_market<TypeParam>(path);
+    ASSERT_EQ(G.order(), 3);
+    ASSERT_EQ(G.size(), 2);
+    ASSERT_TRUE(G.has_edge(EID(2, 0)));
+    ASSERT_FALSE(G.has_edge(EID(1, 0)));
+    {
+        std::ofstream out(path);
+        out << "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n";
+    }
+    ASSERT_THROW(read_matrix_market<TypeParam>(path), std::runtime_error);
+    {
+        std::ofstream out(path);
+        out << "%%MatrixMarket matrix coordinate pattern general\n2 2 1\n3 1\n";
+    }
+    ASSERT_THROW(read_matrix_market<TypeParam>(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TYPED_TEST(IOTest, DIMACS) {
+    const std::string path = temporary("graph.gr");
+    {
+        std::ofstream out(path);
+        out << "c comment\np sp 4 3\na 1 2 7\nc comment\na 2 3 1\ne 3 4\n";
+    }
+    TypeParam G = read_dimacs<TypeParam>(path);
+    ASSERT_EQ(G.order(), 4);
+    ASSERT_EQ(G.size(), 4);
+    ASSERT_TRUE(G.has_edge(EID(2, 3)));
+    ASSERT_TRUE(G.has_edge(EID(3, 2)));
+    ASSERT_FALSE(G.has_edge(EID(1, 0)));
+    ASSERT_EQ(G.template get_attr<double>(EID(0, 1), "weight"), 7);
+    ASSERT_FALSE(G.has_attr(EID(2, 3), "weight"));
+    {
+        std::ofstream out(path);
+        out << "p sp 2 1\na 1 3\n";
+    }
+    ASSERT_THROW(read_dimacs<TypeParam>(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TYPED_TEST(IOTest, Writers) {
+    TypeParam G(4);
+    G.add_edge(EID(0, 1));
+    G.add_edge(EID(1, 2));
+    G.add_edge(EID(2, 0));
+    G.set_label(GLB("g"));
+    G.set_label(VID(0), VLB("a"));
+    G.set_label(VID(1), VLB("b \"quoted\""));
+    G.set_label(EID(1, 2), ELB("<f>"));
+    G.set_attr(VID(0), "w", 7);
+    G.set_attr(EID(0, 1), "weight", 1.5);
+    G.set_attr(EID(2, 0), "weight", 2.0);
+
+    std::ostringstream dot;
+    write_dot(G, dot);
+    ASSERT_EQ(dot.str(),
+              "digraph {\n"
+              "  label=\"g\";\n"
+              "  0 [label=\"a\", \"w\"=7];\n"
+              "  1 [label=\"b \\\"quoted\\\"\"];\n"
+              "  2;\n"
+              "  3;\n"
+              "  0 -> 1 [\"weight\"=\"1.5\"];\n"
+              "  1 -> 2 [label=\"<f>\"];\n"
+              "  2 -> 0 [\"weight\"=\"2\"];\n"
+              "}\n");
+
+    std::ostringstream graphml;
+    write_graphml(G, graphml);
+    const std::string xml = graphml.str();
+    ASSERT_NE(xml.find("<key id=\"v0\" for=\"node\" attr.name=\"w\" attr.type=\"int\"/>"), std::string::npos);
+    ASSERT_NE(xml.find("<key id=\"e0\" for=\"edge\" attr.name=\"weight\" attr.type=\"double\"/>"), std::string::npos);
+    ASSERT_NE(xml.find("<data key=\"vl\">b &quot;quoted&quot;</data>"), std::string::npos);
+    ASSERT_NE(xml.find("<edge source=\"n1\" target=\"n2\">\n      <data key=\"el\">&lt;f&gt;</data></edge>"),
+              std::string::npos);
+    ASSERT_NE(xml.find("<node id=\"n3\"></node>"), std::string::npos);
+
+    std::ostringstream json;
+    write_json(G, json);
+    ASSERT_EQ(json.str(),
+              "{\"directed\": true, \"multigraph\": false, \"graph\": {\"label\": \"g\"},\n"
+              "\"nodes\": [\n"
+              "  {\"id\": 0, \"label\": \"a\", \"w\": 7},\n"
+              "  {\"id\": 1, \"label\": \"b \\\"quoted\\\"\"},\n"
+              "  {\"id\": 2},\n"
+              "  {\"id\": 3}\n"
+              "],\n"
+              "\"links\": [\n"
+              "  {\"source\": 0, \"target\": 1, \"weight\": 1.5},\n"
+              "  {\"source\": 1, \"target\": 2, \"label\": \"<f>\"},\n"
+              "  {\"source\": 2, \"target\": 0, \"weight\": 2}\n"
+              "]}\n");
+
+    // Edge lists are read back.
+    const std::string path = temporary("written.txt");
+    EdgeListOptions options;
+    options.base = 1;
+    options.weight = "weight";
+    write_edge_list(G, path, options);
+    const TypeParam H = read_edge_list<TypeParam>(path, options);
+    ASSERT_EQ(H.order(), 3);
+    ASSERT_EQ(H.size(), 3);
+    ASSERT_TRUE(H.has_edge(EID(2, 0)));
+    ASSERT_EQ(H.template get_attr<double>(EID(0, 1), "weight"), 1.5);
+    ASSERT_FALSE(H.has_attr(EID(1, 2), "weight"));
+    options.labels = true;
+    ASSERT_THROW(write_edge_list(G, path, options), std::invalid_argument);
+    // Labels are read back, unless they hold separators.
+    G.set_label(VID(2), VLB("c"));
+    G.set_label(VID(3), VLB("d"));
+    ASSERT_THROW(write_edge_list(G, path, options), std::invalid_argument);
+    for (const char *label : {"b,c", "b\tc", "#b"}) {
+        G.set_label(VID(1), VLB(label));
+        ASSERT_THROW(write_edge_list(G, path, options), std::invalid_argument);
+    }
+    G.set_label(VID(1), VLB("b"));
+    write_edge_list(G, path, options);
+    const TypeParam L = read_edge_list<TypeParam>(path, options);
+    ASSERT_EQ(L.size(), 3);
+    ASSERT_EQ(L.get_label(VID(1)), "b");
+    ASSERT_TRUE(L.has_edge(VLB("c"), VLB("a")));
+    std::remove(path.c_str());
+}